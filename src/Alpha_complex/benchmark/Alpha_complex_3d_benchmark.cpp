@@ -18,7 +18,7 @@
 std::ofstream results_csv("results.csv");
 
 template <typename Kernel>
-void benchmark_points_on_torus_dD(const std::string& msg) {
+void benchmark_points_on_torus_dD(const std::string& msg, bool filtered = false) {
   std::clog << "+ " << msg << std::endl;
 
   results_csv << "\"" << msg << "\";" << std::endl;
@@ -46,7 +46,10 @@ void benchmark_points_on_torus_dD(const std::string& msg) {
     Gudhi::Simplex_tree<> complex;
     Gudhi::Clock st_create_clock("    benchmark_points_on_torus_dD - complex creation");
     st_create_clock.begin();
-    alpha_complex_from_points.create_complex(complex);
+    if (filtered)
+      alpha_complex_from_points.filtered_create_complex(complex);
+    else
+      alpha_complex_from_points.create_complex(complex);
     st_create_clock.end();
     std::clog << st_create_clock;
 
@@ -245,6 +248,8 @@ int main(int argc, char** argv) {
   benchmark_points_on_torus_dD<CGAL::Epick_d<CGAL::Dynamic_dimension_tag>>("Fast dynamic dimension version");
   benchmark_points_on_torus_dD<CGAL::Epeck_d<CGAL::Dimension_tag<3>>>("Exact static dimension version");
   benchmark_points_on_torus_dD<CGAL::Epeck_d<CGAL::Dynamic_dimension_tag>>("Exact dynamic dimension version");
+  benchmark_points_on_torus_dD<CGAL::Epick_d<CGAL::Dimension_tag<3>>>("Filtered static dimension version", true);
+  benchmark_points_on_torus_dD<CGAL::Epick_d<CGAL::Dynamic_dimension_tag>>("Filtered dynamic dimension version", true);
 
   benchmark_points_on_torus_3D<
       Gudhi::alpha_complex::Alpha_complex_3d<Gudhi::alpha_complex::complexity::FAST, false, false>>("Fast version");
@@ -252,6 +257,9 @@ int main(int argc, char** argv) {
       Gudhi::alpha_complex::Alpha_complex_3d<Gudhi::alpha_complex::complexity::SAFE, false, false>>("Safe version");
   benchmark_points_on_torus_3D<
       Gudhi::alpha_complex::Alpha_complex_3d<Gudhi::alpha_complex::complexity::EXACT, false, false>>("Exact version");
+  benchmark_points_on_torus_3D<
+      Gudhi::alpha_complex::Alpha_complex_3d<Gudhi::alpha_complex::complexity::FILTERED, false, false>>(
+      "Filtered version");
 
   benchmark_weighted_points_on_torus_3D<
       Gudhi::alpha_complex::Alpha_complex_3d<Gudhi::alpha_complex::complexity::FAST, true, false>>("Fast version");
@@ -92,6 +92,10 @@ namespace alpha_complex {
  * In example, :
  * \image html "alpha_complex_doc.png" "Simplicial complex structure construction example"
  *
+ * When the simplicial complex is a `Simplex_tree`, the faces of the cells are first gathered dimension by dimension,
+ * sorted and deduplicated, and the tree is then built at once from these faces in lexicographical order, without
+ * searching for the faces already inserted.
+ *
  * \subsection filtrationcomputation Filtration value computation algorithm
  * <br>
  * \f$
@@ -146,6 +150,21 @@ namespace alpha_complex {
  * `SimplicialComplexForAlpha::prune_above_filtration()`).
  * In the following example, the value is given by the user as argument of the program.
  *
+ * \subsubsection parallelfiltration Parallel computation
+ *
+ * `Alpha_complex::parallel_create_complex` computes the same filtration values when TBB is available, with the
+ * squared radii, the circumspheres and the Gabriel tests of the simplices of a given dimension computed in parallel,
+ * block by block. Only the propagation of the filtration values to the faces, which is cheap, remains sequential, so
+ * that the result does not depend on the order in which the threads run.
+ *
+ * \subsubsection filteredfiltration Filtered computation
+ *
+ * `Alpha_complex::filtered_create_complex` computes the squared radii and the Gabriel tests in interval arithmetic
+ * from the coordinates of the points, and only recomputes them exactly, with rationals, for the simplices where the
+ * intervals are too wide to conclude. With `CGAL::Epick_d`, it gives the guarantees of `CGAL::Epeck_d` (exact
+ * Gabriel tests, and filtration values with a small relative error) for a cost close to the one of the inexact
+ * constructions.
+ *
  *
  * \section offexample Example from OFF file
  *
@@ -170,8 +189,11 @@ namespace alpha_complex {
  *
  * A specific module for Alpha complex is available in 3d (cf. Alpha_complex_3d) and allows to construct standard,
  * weighted, periodic or weighted and periodic versions of alpha complexes. Alpha values computation can be
- * Gudhi::alpha_complex::complexity::FAST, Gudhi::alpha_complex::complexity::SAFE (default value) or
- * Gudhi::alpha_complex::complexity::EXACT.
+ * Gudhi::alpha_complex::complexity::FAST, Gudhi::alpha_complex::complexity::SAFE (default value),
+ * Gudhi::alpha_complex::complexity::EXACT or Gudhi::alpha_complex::complexity::FILTERED. The latter compares alpha
+ * values with interval arithmetic on inexact constructions, and only exactly when the intervals overlap, which is
+ * close to the speed of the fast version with the safety of the safe one (for the weighted or periodic versions, or
+ * with \ref cgal &lt; 4.14.0, it is the safe version).
  *
  * This example builds the CGAL 3d weighted alpha shapes from a small molecule, and initializes the alpha complex with
  * it. This example is taken from <a href="https://doc.cgal.org/latest/Alpha_shapes_3/index.html#title13">CGAL 3d
@@ -15,6 +15,9 @@
 #include <gudhi/Debug_utils.h>
 // to construct Alpha_complex from a OFF file of points
 #include <gudhi/Points_off_io.h>
+#include <gudhi/Instrumentation.h>
+#include <gudhi/Alpha_complex/Faces_by_dimension.h>
+#include <gudhi/Alpha_complex/Circumsphere.h>
 
 #include <stdlib.h>
 #include <math.h>  // isnan, fmax
@@ -26,9 +29,15 @@
 #include <CGAL/property_map.h>  // for CGAL::Identity_property_map
 #include <CGAL/version.h>  // for CGAL_VERSION_NR
 #include <CGAL/NT_converter.h>
+#include <CGAL/Interval_nt.h>  // for CGAL::Interval_nt_advanced and CGAL::Protect_FPU_rounding
+#include <CGAL/Exact_rational.h>
 
 #include <Eigen/src/Core/util/Macros.h>  // for EIGEN_VERSION_AT_LEAST
 
+#ifdef GUDHI_USE_TBB
+#include <tbb/parallel_for.h>
+#endif
+
 #include <iostream>
 #include <vector>
 #include <string>
@@ -37,6 +46,9 @@
 #include <utility>  // std::pair
 #include <stdexcept>
 #include <numeric>  // for std::iota
+#include <algorithm>  // for std::sort
+#include <cstddef>  // for std::size_t
+#include <type_traits>  // for std::integral_constant
 
 // Make compilation fail - required for external projects - https://github.com/GUDHI/gudhi-devel/issues/10
 #if CGAL_VERSION_NR < 1041101000
@@ -124,6 +136,10 @@ class Alpha_complex {
   // Numeric type of coordinates in the kernel
   typedef typename Kernel::FT FT;
 
+  // Numeric types of filtered_create_complex: intervals, and exact rationals when the intervals are not conclusive.
+  typedef CGAL::Interval_nt_advanced Interval;
+  typedef CGAL::Exact_rational Exact_rational;
+
  private:
   /** \brief Vertex iterator vector to switch from simplex tree vertex handle to CGAL vertex iterator.
    * Vertex handles are inserted sequentially, starting at 0.*/
@@ -134,6 +150,20 @@ class Alpha_complex {
   Kernel kernel_;
   /** \brief Cache for geometric constructions: circumcenter and squared radius of a simplex.*/
   std::vector<std::pair<Point_d, FT>> cache_, old_cache_;
+  /** \brief Cache for the circumspheres of filtered_create_complex, in interval arithmetic. The center is empty when
+   * the intervals were not conclusive.*/
+  std::vector<Circumsphere<Interval>> interval_cache_, old_interval_cache_;
+  /** \brief Relative width of the interval of a squared radius below which filtered_create_complex does not compute
+   * it exactly, the default relative precision of `CGAL::Lazy_exact_nt::to_double` used by `CGAL::Epeck_d`.*/
+  static constexpr double filtered_relative_precision_ = 1e-5;
+
+  /** \brief Whether the geometric constructions can run concurrently. The lazy exact numbers of `CGAL::Epeck_d`
+   * share their representation and are only thread-safe since CGAL 5.5.*/
+#if CGAL_VERSION_NR >= 1050500000
+  static const bool is_kernel_thread_safe_ = true;
+#else
+  static const bool is_kernel_thread_safe_ = !Is_Epeck_D<Kernel>::value;
+#endif
 
  public:
   /** \brief Alpha_complex constructor from an OFF file name.
@@ -258,6 +288,20 @@ class Alpha_complex {
     return vertex_handle_to_iterator_[vertex]->point();
   }
 
+  /// Return the circumcenter and circumradius of a simplex.
+  template<class SimplicialComplexForAlpha>
+  std::pair<Point_d, FT> circumsphere(SimplicialComplexForAlpha& cplx,
+                                      typename SimplicialComplexForAlpha::Simplex_handle s) {
+    // Using a transform_range is slower, currently.
+    thread_local std::vector<Point_d> v;
+    v.clear();
+    for (auto vertex : cplx.simplex_vertex_range(s))
+      v.push_back(get_point_(vertex));
+    Point_d c = kernel_.construct_circumcenter_d_object()(v.cbegin(), v.cend());
+    FT r = kernel_.squared_distance_d_object()(c, v[0]);
+    return std::make_pair(std::move(c), std::move(r));
+  }
+
   /// Return a reference to the circumcenter and circumradius, writing them in the cache if necessary.
   template<class SimplicialComplexForAlpha>
   auto& get_cache(SimplicialComplexForAlpha& cplx, typename SimplicialComplexForAlpha::Simplex_handle s) {
@@ -265,14 +309,7 @@ class Alpha_complex {
     if(k==cplx.null_key()){
       k = cache_.size();
       cplx.assign_key(s, k);
-      // Using a transform_range is slower, currently.
-      thread_local std::vector<Point_d> v;
-      v.clear();
-      for (auto vertex : cplx.simplex_vertex_range(s))
-        v.push_back(get_point_(vertex));
-      Point_d c = kernel_.construct_circumcenter_d_object()(v.cbegin(), v.cend());
-      FT r = kernel_.squared_distance_d_object()(c, v[0]);
-      cache_.emplace_back(std::move(c), std::move(r));
+      cache_.push_back(circumsphere(cplx, s));
     }
     return cache_[k];
   }
@@ -291,6 +328,93 @@ class Alpha_complex {
     return kernel_.compute_squared_radius_d_object()(v.cbegin(), v.cend());
   }
 
+  static Interval to_number(const FT& x, Interval*) { return Interval(CGAL::to_interval(x)); }
+  static Exact_rational to_number(double x, Exact_rational*) { return Exact_rational(x); }
+  template<typename Lazy_FT>
+  static Exact_rational to_number(const Lazy_FT& x, Exact_rational*) { return Exact_rational(x.exact()); }
+
+  /// Return the coordinates of the point of a vertex, exactly converted to NT.
+  template<typename NT>
+  std::vector<NT> coordinates(std::size_t vertex) {
+    const Point_d& point = get_point_(vertex);
+    const int dim = kernel_.point_dimension_d_object()(point);
+    std::vector<NT> coords;
+    coords.reserve(dim);
+    for (int i = 0; i < dim; ++i)
+      coords.push_back(to_number(kernel_.compute_coordinate_d_object()(point, i), static_cast<NT*>(nullptr)));
+    return coords;
+  }
+
+  /// Return the circumsphere of a simplex in NT, or false if it cannot be computed with certainty.
+  template<typename NT, class SimplicialComplexForAlpha>
+  bool circumsphere(SimplicialComplexForAlpha& cplx, typename SimplicialComplexForAlpha::Simplex_handle s,
+                    Circumsphere<NT>& sphere) {
+    std::vector<std::vector<NT>> points;
+    for (auto vertex : cplx.simplex_vertex_range(s))
+      points.push_back(coordinates<NT>(vertex));
+    return compute_circumsphere(points, sphere);
+  }
+
+  /// Return a reference to the circumsphere in interval arithmetic, writing it in the cache if necessary.
+  template<class SimplicialComplexForAlpha>
+  const Circumsphere<Interval>& get_interval_cache(SimplicialComplexForAlpha& cplx,
+                                                  typename SimplicialComplexForAlpha::Simplex_handle s) {
+    auto k = cplx.key(s);
+    if(k==cplx.null_key()){
+      k = interval_cache_.size();
+      cplx.assign_key(s, k);
+      interval_cache_.emplace_back();
+      if (!circumsphere(cplx, s, interval_cache_.back()))
+        interval_cache_.back().center.clear();
+    }
+    return interval_cache_[k];
+  }
+
+  /// Return the squared circumradius, from intervals either from the old cache or computed, and exactly when the
+  /// intervals are too wide or when exact is true.
+  template<typename Filtration_value, class SimplicialComplexForAlpha>
+  Filtration_value filtered_radius(SimplicialComplexForAlpha& cplx,
+                                   typename SimplicialComplexForAlpha::Simplex_handle s, bool exact) {
+    if (!exact) {
+      CGAL::Protect_FPU_rounding<true> protect;
+      Circumsphere<Interval> computed;
+      auto k = cplx.key(s);
+      const Circumsphere<Interval>* sphere = &computed;
+      if (k != cplx.null_key())
+        sphere = &old_interval_cache_[k];
+      else if (!circumsphere(cplx, s, computed))
+        computed.center.clear();
+      if (!sphere->center.empty()) {
+        const Interval& sqrad = sphere->squared_radius;
+        if (sqrad.sup() - sqrad.inf() <= filtered_relative_precision_ * sqrad.sup())
+          return static_cast<Filtration_value>(CGAL::to_double(sqrad));
+      }
+    }
+    Circumsphere<Exact_rational> sphere;
+    circumsphere(cplx, s, sphere);
+    return static_cast<Filtration_value>(CGAL::to_double(sphere.squared_radius));
+  }
+
+  /// Return whether f_boundary is Gabriel for its coface of extra vertex, with intervals, and exactly when these are
+  /// not conclusive.
+  template<class SimplicialComplexForAlpha>
+  bool filtered_is_gabriel(SimplicialComplexForAlpha& cplx,
+                           typename SimplicialComplexForAlpha::Simplex_handle f_boundary,
+                           typename SimplicialComplexForAlpha::Vertex_handle extra) {
+    {
+      CGAL::Protect_FPU_rounding<true> protect;
+      const Circumsphere<Interval>& sphere = get_interval_cache(cplx, f_boundary);
+      if (!sphere.center.empty()) {
+        Interval power = power_to_circumsphere(sphere, coordinates<Interval>(extra));
+        if (CGAL::certainly(power >= Interval(0))) return true;
+        if (CGAL::certainly(power < Interval(0))) return false;
+      }
+    }
+    Circumsphere<Exact_rational> sphere;
+    circumsphere(cplx, f_boundary, sphere);
+    return power_to_circumsphere(sphere, coordinates<Exact_rational>(extra)) >= 0;
+  }
+
  public:
   /** \brief Inserts all Delaunay triangulation into the simplicial complex.
    * It also computes the filtration values accordingly to the \ref createcomplexalgorithm if default_filtration_value
@@ -321,6 +445,56 @@ class Alpha_complex {
                       Filtration_value max_alpha_square = std::numeric_limits<Filtration_value>::infinity(),
                       bool exact = false,
                       bool default_filtration_value = false) {
+    return create_complex_(complex, max_alpha_square, exact, default_filtration_value, false, false);
+  }
+
+  /** \brief Same as `create_complex()`, but if TBB is available, the filtration values of the simplices of a given
+   * dimension are computed in parallel.
+   *
+   * The simplices of each dimension are processed by blocks. In a block, the squared radii of the simplices, the
+   * circumspheres of their facets and the Gabriel tests of the facets run concurrently, and the filtration values
+   * are then propagated to the facets in the order of `create_complex()`. The resulting filtration values are
+   * identical to the ones of `create_complex()`.
+   *
+   * \tparam SimplicialComplexForAlpha must meet `SimplicialComplexForAlpha` concept. Besides, `filtration`, `key`,
+   * `simplex_vertex_range` and `boundary_simplex_range` must be callable concurrently, and so must be
+   * `assign_filtration` on distinct simplices, as for `Simplex_tree`.
+   *
+   * With `CGAL::Epeck_d` and a CGAL version older than 5.5, whose lazy exact numbers are not thread-safe, the
+   * filtration values are computed sequentially.
+   */
+  template <typename SimplicialComplexForAlpha,
+            typename Filtration_value = typename SimplicialComplexForAlpha::Filtration_value>
+  bool parallel_create_complex(SimplicialComplexForAlpha& complex,
+                               Filtration_value max_alpha_square = std::numeric_limits<Filtration_value>::infinity(),
+                               bool exact = false,
+                               bool default_filtration_value = false) {
+    return create_complex_(complex, max_alpha_square, exact, default_filtration_value, is_kernel_thread_safe_,
+                           false);
+  }
+
+  /** \brief Same as `create_complex()`, but the squared radii and the Gabriel tests are computed from the coordinates
+   * of the points in interval arithmetic, and only exactly, in rationals, when the intervals are not conclusive.
+   *
+   * The Gabriel tests are thus always exact, and the filtration values have a relative error smaller than
+   * \f$10^{-5}\f$ (or are exact if `exact` is `true`), as with `CGAL::Epeck_d`, but with `CGAL::Epick_d` the
+   * computation is almost as fast as `create_complex()`, which relies on the inexact constructions of the kernel. With
+   * `CGAL::Epeck_d`, it also avoids the cost of its lazy constructions.
+   */
+  template <typename SimplicialComplexForAlpha,
+            typename Filtration_value = typename SimplicialComplexForAlpha::Filtration_value>
+  bool filtered_create_complex(SimplicialComplexForAlpha& complex,
+                               Filtration_value max_alpha_square = std::numeric_limits<Filtration_value>::infinity(),
+                               bool exact = false,
+                               bool default_filtration_value = false) {
+    return create_complex_(complex, max_alpha_square, exact, default_filtration_value, false, true);
+  }
+
+ private:
+  template <typename SimplicialComplexForAlpha, typename Filtration_value>
+  bool create_complex_(SimplicialComplexForAlpha& complex, Filtration_value max_alpha_square, bool exact,
+                       bool default_filtration_value, bool parallel, bool filtered) {
+    GUDHI_INSTRUMENT_SCOPE("Alpha_complex::create_complex");
     // From SimplicialComplexForAlpha type required to insert into a simplicial complex (with or without subfaces).
     typedef typename SimplicialComplexForAlpha::Vertex_handle Vertex_handle;
     typedef typename SimplicialComplexForAlpha::Simplex_handle Simplex_handle;
@@ -342,27 +516,47 @@ class Alpha_complex {
     // --------------------------------------------------------------------------------------------
     // Simplex_tree construction from loop on triangulation finite full cells list
     if (triangulation_->number_of_vertices() > 0) {
-      for (auto cit = triangulation_->finite_full_cells_begin();
-           cit != triangulation_->finite_full_cells_end();
-           ++cit) {
+      typedef typename SimplicialComplexForAlpha::Filtration_value Complex_filtration_value;
+      typedef Is_constructible_from_sorted_faces<SimplicialComplexForAlpha, Complex_filtration_value> Bulk_build;
+      if (Bulk_build::value) {
+        // The faces of all the full cells are deduplicated as they are added, then sorted, and the complex is built
+        // at once.
+        Faces_by_dimension<Vertex_handle, Complex_filtration_value> faces;
         Vector_vertex vertexVector;
+        for (auto cit = triangulation_->finite_full_cells_begin();
+             cit != triangulation_->finite_full_cells_end();
+             ++cit) {
+          vertexVector.clear();
+          for (auto vit = cit->vertices_begin(); vit != cit->vertices_end(); ++vit) {
+            if (*vit != nullptr) vertexVector.push_back((*vit)->data());
+          }
+          std::sort(vertexVector.begin(), vertexVector.end());
+          faces.add_faces_of_simplex(vertexVector, std::numeric_limits<Complex_filtration_value>::quiet_NaN());
+        }
+        assign_faces(complex, faces, Bulk_build());
+      } else {
+        for (auto cit = triangulation_->finite_full_cells_begin();
+             cit != triangulation_->finite_full_cells_end();
+             ++cit) {
+          Vector_vertex vertexVector;
 #ifdef DEBUG_TRACES
-        std::clog << "Simplex_tree insertion ";
+          std::clog << "Simplex_tree insertion ";
 #endif  // DEBUG_TRACES
-        for (auto vit = cit->vertices_begin(); vit != cit->vertices_end(); ++vit) {
-          if (*vit != nullptr) {
+          for (auto vit = cit->vertices_begin(); vit != cit->vertices_end(); ++vit) {
+            if (*vit != nullptr) {
 #ifdef DEBUG_TRACES
-            std::clog << " " << (*vit)->data();
+              std::clog << " " << (*vit)->data();
 #endif  // DEBUG_TRACES
-            // Vector of vertex construction for simplex_tree structure
-            vertexVector.push_back((*vit)->data());
+              // Vector of vertex construction for simplex_tree structure
+              vertexVector.push_back((*vit)->data());
+            }
           }
-        }
 #ifdef DEBUG_TRACES
-        std::clog << std::endl;
+          std::clog << std::endl;
 #endif  // DEBUG_TRACES
-        // Insert each simplex and its subfaces in the simplex tree - filtration is NaN
-        complex.insert_simplex_and_subfaces(vertexVector, std::numeric_limits<double>::quiet_NaN());
+          // Insert each simplex and its subfaces in the simplex tree - filtration is NaN
+          complex.insert_simplex_and_subfaces(vertexVector, std::numeric_limits<double>::quiet_NaN());
+        }
       }
     }
     // --------------------------------------------------------------------------------------------
@@ -371,6 +565,12 @@ class Alpha_complex {
       // --------------------------------------------------------------------------------------------
       // ### For i : d -> 0
       for (int decr_dim = triangulation_->maximal_dimension(); decr_dim >= 0; decr_dim--) {
+        if (parallel) {
+          assign_alpha_filtration_in_blocks<Filtration_value>(complex, decr_dim, exact);
+          old_cache_ = std::move(cache_);
+          cache_.clear();
+          continue;
+        }
         // ### Foreach Sigma of dim i
         for (Simplex_handle f_simplex : complex.skeleton_simplex_range(decr_dim)) {
           int f_simplex_dim = complex.dimension(f_simplex);
@@ -379,7 +579,9 @@ class Alpha_complex {
             if (std::isnan(complex.filtration(f_simplex))) {
               Filtration_value alpha_complex_filtration = 0.0;
               // No need to compute squared_radius on a single point - alpha is 0.0
-              if (f_simplex_dim > 0) {
+              if (f_simplex_dim > 0 && filtered) {
+                alpha_complex_filtration = filtered_radius<Filtration_value>(complex, f_simplex, exact);
+              } else if (f_simplex_dim > 0) {
                 auto const& sqrad = radius(complex, f_simplex);
 #if CGAL_VERSION_NR >= 1050000000
                 if(exact) CGAL::exact(sqrad);
@@ -394,11 +596,13 @@ class Alpha_complex {
             }
             // No need to propagate further, unweighted points all have value 0
             if (decr_dim > 1)
-              propagate_alpha_filtration(complex, f_simplex);
+              propagate_alpha_filtration(complex, f_simplex, filtered);
           }
         }
         old_cache_ = std::move(cache_);
         cache_.clear();
+        old_interval_cache_ = std::move(interval_cache_);
+        interval_cache_.clear();
       }
       // --------------------------------------------------------------------------------------------
   
@@ -412,9 +616,120 @@ class Alpha_complex {
     return true;
   }
 
- private:
+  /** \brief Computes the filtration values of the simplices of dimension dim, and propagates them to their facets as
+   * `propagate_alpha_filtration` does, by blocks of simplices.
+   */
+  template <typename Filtration_value, typename SimplicialComplexForAlpha>
+  void assign_alpha_filtration_in_blocks(SimplicialComplexForAlpha& complex, int dim, bool exact) {
+    typedef typename SimplicialComplexForAlpha::Simplex_handle Simplex_handle;
+    // Bounds the memory used to store the facets of a block, while leaving enough work to each thread.
+    const std::size_t block_size = 1 << 16;
+    std::vector<Simplex_handle> block;
+    block.reserve(block_size);
+    for (Simplex_handle f_simplex : complex.skeleton_simplex_range(dim)) {
+      if (complex.dimension(f_simplex) != dim) continue;
+      block.push_back(f_simplex);
+      if (block.size() == block_size) {
+        assign_alpha_filtration_of_block<Filtration_value>(complex, block, dim, exact);
+        block.clear();
+      }
+    }
+    assign_alpha_filtration_of_block<Filtration_value>(complex, block, dim, exact);
+  }
+
+  template <typename Filtration_value, typename SimplicialComplexForAlpha>
+  void assign_alpha_filtration_of_block(SimplicialComplexForAlpha& complex,
+                                        const std::vector<typename SimplicialComplexForAlpha::Simplex_handle>& block,
+                                        int dim, bool exact) {
+    typedef typename SimplicialComplexForAlpha::Simplex_handle Simplex_handle;
+    typedef typename SimplicialComplexForAlpha::Vertex_handle Vertex_handle;
+    auto for_each_index = [](std::size_t size, auto&& f) {
+#ifdef GUDHI_USE_TBB
+      tbb::parallel_for(std::size_t(0), size, f);
+#else
+      for (std::size_t i = 0; i < size; ++i) f(i);
+#endif
+    };
+    // No need to propagate further, unweighted points all have value 0
+    const std::size_t num_facets = (dim > 1) ? dim + 1 : 0;
+    std::vector<Simplex_handle> facets(block.size() * num_facets);
+    std::vector<Vertex_handle> extra_vertices(facets.size());
+
+    // ### If filt(Sigma) is NaN : filt(Sigma) = alpha(Sigma), and collect the facets Tau of Sigma.
+    for_each_index(block.size(), [&](std::size_t i) {
+      if (std::isnan(complex.filtration(block[i]))) {
+        Filtration_value alpha_complex_filtration = 0.0;
+        // No need to compute squared_radius on a single point - alpha is 0.0
+        if (dim > 0) {
+          auto const& sqrad = radius(complex, block[i]);
+#if CGAL_VERSION_NR >= 1050000000
+          if(exact) CGAL::exact(sqrad);
+#endif
+          CGAL::NT_converter<FT, Filtration_value> cv;
+          alpha_complex_filtration = cv(sqrad);
+        }
+        complex.assign_filtration(block[i], alpha_complex_filtration);
+      }
+      if (num_facets == 0) return;
+      std::size_t j = i * num_facets;
+      for (auto f_boundary : complex.boundary_simplex_range(block[i])) {
+        facets[j] = f_boundary;
+        extra_vertices[j] = missing_vertex(complex, block[i], f_boundary);
+        ++j;
+      }
+    });
+    if (num_facets == 0) return;
+
+    // The keys of the facets are assigned in the order of get_cache in propagate_alpha_filtration.
+    std::vector<Simplex_handle> new_facets;
+    for (Simplex_handle f_boundary : facets) {
+      if (complex.key(f_boundary) == complex.null_key()) {
+        complex.assign_key(f_boundary, cache_.size() + new_facets.size());
+        new_facets.push_back(f_boundary);
+      }
+    }
+    std::size_t first_new_key = cache_.size();
+    cache_.resize(cache_.size() + new_facets.size());
+    for_each_index(new_facets.size(), [&](std::size_t i) {
+      cache_[first_new_key + i] = circumsphere(complex, new_facets[i]);
+    });
+
+    // ### Is Tau Gabriel of Sigma
+    std::vector<char> is_gabriel(facets.size());
+    for_each_index(facets.size(), [&](std::size_t j) {
+      auto const& cache = cache_[complex.key(facets[j])];
+      is_gabriel[j] = kernel_.squared_distance_d_object()(cache.first, get_point_(extra_vertices[j])) >= cache.second;
+    });
+
+    // Same propagation as propagate_alpha_filtration, in the same order.
+    for (std::size_t i = 0; i < block.size(); ++i) {
+      for (std::size_t j = i * num_facets; j < (i + 1) * num_facets; ++j) {
+        if (!std::isnan(complex.filtration(facets[j]))) {
+          complex.assign_filtration(facets[j], fmin(complex.filtration(facets[j]), complex.filtration(block[i])));
+        } else if (!is_gabriel[j]) {
+          complex.assign_filtration(facets[j], complex.filtration(block[i]));
+        }
+      }
+    }
+  }
+
+  /** \brief Returns the vertex of f_simplex which is not in its facet f_boundary. */
   template <typename SimplicialComplexForAlpha, typename Simplex_handle>
-  void propagate_alpha_filtration(SimplicialComplexForAlpha& complex, Simplex_handle f_simplex) {
+  typename SimplicialComplexForAlpha::Vertex_handle missing_vertex(SimplicialComplexForAlpha& complex,
+                                                                   Simplex_handle f_simplex,
+                                                                   Simplex_handle f_boundary) {
+    // We rely on the fact that simplex_vertex_range is sorted.
+    auto longlist = complex.simplex_vertex_range(f_simplex);
+    auto shortlist = complex.simplex_vertex_range(f_boundary);
+    auto longiter = std::begin(longlist);
+    auto shortiter = std::begin(shortlist);
+    auto enditer = std::end(shortlist);
+    while(shortiter != enditer && *longiter == *shortiter) { ++longiter; ++shortiter; }
+    return *longiter;
+  }
+
+  template <typename SimplicialComplexForAlpha, typename Simplex_handle>
+  void propagate_alpha_filtration(SimplicialComplexForAlpha& complex, Simplex_handle f_simplex, bool filtered) {
     // From SimplicialComplexForAlpha type required to assign filtration values.
     typedef typename SimplicialComplexForAlpha::Filtration_value Filtration_value;
     typedef typename SimplicialComplexForAlpha::Vertex_handle Vertex_handle;
@@ -441,16 +756,16 @@ class Alpha_complex {
 #endif  // DEBUG_TRACES
         // ### Else
       } else {
-        // Find which vertex of f_simplex is missing in f_boundary. We could actually write a variant of boundary_simplex_range that gives pairs (f_boundary, vertex). We rely on the fact that simplex_vertex_range is sorted.
-        auto longlist = complex.simplex_vertex_range(f_simplex);
-        auto shortlist = complex.simplex_vertex_range(f_boundary);
-        auto longiter = std::begin(longlist);
-        auto shortiter = std::begin(shortlist);
-        auto enditer = std::end(shortlist);
-        while(shortiter != enditer && *longiter == *shortiter) { ++longiter; ++shortiter; }
-        Vertex_handle extra = *longiter;
-        auto const& cache=get_cache(complex, f_boundary);
-        bool is_gab = kernel_.squared_distance_d_object()(cache.first, get_point_(extra)) >= cache.second;
+        // Find which vertex of f_simplex is missing in f_boundary. We could actually write a variant of
+        // boundary_simplex_range that gives pairs (f_boundary, vertex).
+        Vertex_handle extra = missing_vertex(complex, f_simplex, f_boundary);
+        bool is_gab;
+        if (filtered) {
+          is_gab = filtered_is_gabriel(complex, f_boundary, extra);
+        } else {
+          auto const& cache=get_cache(complex, f_boundary);
+          is_gab = kernel_.squared_distance_d_object()(cache.first, get_point_(extra)) >= cache.second;
+        }
 #ifdef DEBUG_TRACES
         std::clog << " | Tau is_gabriel(Sigma)=" << is_gab << " - vertexForGabriel=" << extra << std::endl;
 #endif  // DEBUG_TRACES
@@ -0,0 +1,99 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Clément Maria
+ *
+ *    Copyright (C) 2020 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef ALPHA_COMPLEX_CIRCUMSPHERE_H_
+#define ALPHA_COMPLEX_CIRCUMSPHERE_H_
+
+#include <CGAL/Uncertain.h>  // for CGAL::certainly
+
+#include <vector>
+#include <cstddef>  // for std::size_t
+
+namespace Gudhi {
+
+namespace alpha_complex {
+
+/* \brief Smallest circumsphere of a simplex, with coordinates in a number type NT which may be an interval type. */
+template<typename NT>
+struct Circumsphere {
+  std::vector<NT> center;
+  NT squared_radius;
+};
+
+/* \brief Computes the smallest circumsphere of the simplex whose vertices have the given coordinates.
+ *
+ * The circumcenter is \f$ p_0 + \sum_i \lambda_i (p_i - p_0) \f$, where \f$ \lambda \f$ solves the linear system of
+ * the Gram matrix of the vectors \f$ p_i - p_0 \f$, which is positive definite for a non-degenerate simplex, hence
+ * solved by a Gaussian elimination without pivoting.
+ *
+ * @return false if the sign of a pivot is uncertain, which can only happen with an interval number type.
+ */
+template<typename NT>
+bool compute_circumsphere(const std::vector<std::vector<NT>>& points, Circumsphere<NT>& sphere) {
+  const std::vector<NT>& origin = points[0];
+  const std::size_t dim = points.size() - 1;
+  const std::size_t ambient_dim = origin.size();
+  std::vector<std::vector<NT>> vectors(dim, std::vector<NT>(ambient_dim));
+  for (std::size_t i = 0; i < dim; ++i)
+    for (std::size_t c = 0; c < ambient_dim; ++c) vectors[i][c] = points[i + 1][c] - origin[c];
+
+  // The Gram matrix, with the half squared norms of the vectors as last column.
+  std::vector<std::vector<NT>> gram(dim, std::vector<NT>(dim + 1, NT(0)));
+  for (std::size_t i = 0; i < dim; ++i) {
+    for (std::size_t j = 0; j <= i; ++j) {
+      NT dot(0);
+      for (std::size_t c = 0; c < ambient_dim; ++c) dot += vectors[i][c] * vectors[j][c];
+      gram[i][j] = gram[j][i] = dot;
+    }
+    gram[i][dim] = gram[i][i] / NT(2);
+  }
+  for (std::size_t k = 0; k < dim; ++k) {
+    if (!CGAL::certainly(gram[k][k] > NT(0))) return false;
+    for (std::size_t i = k + 1; i < dim; ++i) {
+      NT factor = gram[i][k] / gram[k][k];
+      for (std::size_t j = k + 1; j <= dim; ++j) gram[i][j] -= factor * gram[k][j];
+    }
+  }
+  std::vector<NT> lambda(dim);
+  for (std::size_t k = dim; k-- > 0;) {
+    NT value = gram[k][dim];
+    for (std::size_t j = k + 1; j < dim; ++j) value -= gram[k][j] * lambda[j];
+    lambda[k] = value / gram[k][k];
+  }
+
+  std::vector<NT> offset(ambient_dim, NT(0));
+  for (std::size_t i = 0; i < dim; ++i)
+    for (std::size_t c = 0; c < ambient_dim; ++c) offset[c] += lambda[i] * vectors[i][c];
+  sphere.squared_radius = NT(0);
+  sphere.center.resize(ambient_dim);
+  for (std::size_t c = 0; c < ambient_dim; ++c) {
+    sphere.squared_radius += offset[c] * offset[c];
+    sphere.center[c] = origin[c] + offset[c];
+  }
+  return true;
+}
+
+/* \brief Returns the squared distance from point to the center of sphere, minus the squared radius of sphere, which is
+ * non-negative if and only if point is not strictly inside sphere. */
+template<typename NT>
+NT power_to_circumsphere(const Circumsphere<NT>& sphere, const std::vector<NT>& point) {
+  NT squared_distance(0);
+  for (std::size_t c = 0; c < point.size(); ++c) {
+    NT diff = point[c] - sphere.center[c];
+    squared_distance += diff * diff;
+  }
+  return squared_distance - sphere.squared_radius;
+}
+
+}  // namespace alpha_complex
+
+}  // namespace Gudhi
+
+#endif  // ALPHA_COMPLEX_CIRCUMSPHERE_H_
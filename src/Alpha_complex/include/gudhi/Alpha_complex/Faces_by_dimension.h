@@ -0,0 +1,268 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Clément Maria
+ *
+ *    Copyright (C) 2020 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef ALPHA_COMPLEX_FACES_BY_DIMENSION_H_
+#define ALPHA_COMPLEX_FACES_BY_DIMENSION_H_
+
+#include <boost/container/container_fwd.hpp>  // for ordered_unique_range_t
+#include <boost/range/iterator_range.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+
+#include <vector>
+#include <utility>  // for std::pair
+#include <algorithm>  // for std::sort, std::equal, std::lexicographical_compare
+#include <iterator>  // for std::begin, std::end, std::distance
+#include <numeric>  // for std::iota
+#include <functional>  // for std::hash
+#include <cstddef>  // for std::size_t
+#include <type_traits>  // for std::is_constructible
+
+namespace Gudhi {
+
+namespace alpha_complex {
+
+/* \brief Faces of a triangulation, stored dimension by dimension as sorted vertices in flat arrays.
+ *
+ * Each face is stored once: a face which is added again is found in a hash table of the faces of its dimension.
+ * The faces of a dimension are then sorted lexicographically by `sort()`, which allows to enumerate all the faces in
+ * the lexicographical order of `Simplex_tree`, i.e. the order of a depth-first traversal, and to build the complex at
+ * once, with one node created per face and no search in the tree. */
+template<typename Vertex_handle, typename Filtration_value>
+class Faces_by_dimension {
+ public:
+  /* \brief Type of a face in the lexicographical order: its vertices and its filtration value. */
+  typedef std::pair<boost::iterator_range<const Vertex_handle*>, Filtration_value> Face;
+  class Face_iterator;
+  /* \brief Range of all the faces in lexicographical order. */
+  typedef boost::iterator_range<Face_iterator> Face_range;
+
+  /* \brief Adds a face, whose vertices must be sorted by increasing vertex, if it has not been added yet. Returns
+   * whether it has been added. */
+  template<typename VertexRange>
+  bool add_face(const VertexRange& vertices, Filtration_value filtration) {
+    std::size_t dim = static_cast<std::size_t>(std::distance(std::begin(vertices), std::end(vertices))) - 1;
+    if (dim >= vertices_.size()) {
+      vertices_.resize(dim + 1);
+      filtrations_.resize(dim + 1);
+      tables_.resize(dim + 1);
+    }
+    std::vector<Vertex_handle>& faces = vertices_[dim];
+    std::vector<std::size_t>& table = tables_[dim];
+    const std::size_t num_faces = filtrations_[dim].size();
+    // The load factor of the table is at most 1/2.
+    if (2 * (num_faces + 1) > table.size()) rehash(dim, (std::max)(std::size_t(16), 2 * table.size()));
+    const std::size_t mask = table.size() - 1;
+    for (std::size_t slot = hash(std::begin(vertices), std::end(vertices)) & mask;; slot = (slot + 1) & mask) {
+      if (table[slot] == 0) {
+        table[slot] = num_faces + 1;
+        break;
+      }
+      if (std::equal(std::begin(vertices), std::end(vertices), faces.begin() + (table[slot] - 1) * (dim + 1)))
+        return false;
+    }
+    faces.insert(faces.end(), std::begin(vertices), std::end(vertices));
+    filtrations_[dim].push_back(filtration);
+    return true;
+  }
+
+  /* \brief Adds all the faces of a simplex, whose vertices must be sorted by increasing vertex.
+   *
+   * The faces of a face already added are not looked up, hence the faces must only be added with this function. */
+  template<typename VertexRange>
+  void add_faces_of_simplex(const VertexRange& vertices, Filtration_value filtration) {
+    simplex_.assign(std::begin(vertices), std::end(vertices));
+    const std::size_t full = (std::size_t(1) << simplex_.size()) - 1;
+    // Each subset of the vertices is a bit mask, whose bits are read in increasing order to keep the face sorted.
+    // The subsets are visited by decreasing size, and the ones included in a face already added are skipped.
+    present_.clear();
+    for (std::size_t size = simplex_.size(); size > 0; --size) {
+      for (std::size_t mask = full; mask > 0; --mask) {
+        if (popcount(mask) != size) continue;
+        bool is_known = false;
+        for (std::size_t known : present_) {
+          if ((mask & known) == mask) {
+            is_known = true;
+            break;
+          }
+        }
+        if (is_known) continue;
+        face_.clear();
+        for (std::size_t i = 0; i < simplex_.size(); ++i)
+          if (mask & (std::size_t(1) << i)) face_.push_back(simplex_[i]);
+        if (!add_face(face_, filtration)) present_.push_back(mask);
+      }
+    }
+  }
+
+  /* \brief Releases the hash tables, no face can be added afterwards, and sorts the faces of each dimension
+   * lexicographically. */
+  void sort() {
+    tables_.clear();
+    tables_.shrink_to_fit();
+    for (std::size_t dim = 0; dim < vertices_.size(); ++dim) {
+      const std::size_t stride = dim + 1;
+      const std::vector<Vertex_handle>& vertices = vertices_[dim];
+      auto face = [&vertices, stride](std::size_t i) { return vertices.begin() + i * stride; };
+      std::vector<std::size_t> order(filtrations_[dim].size());
+      std::iota(order.begin(), order.end(), 0);
+      // Faces are unique, the order does not need to be stable.
+      std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+        return std::lexicographical_compare(face(a), face(a) + stride, face(b), face(b) + stride);
+      });
+      std::vector<Vertex_handle> sorted_vertices;
+      sorted_vertices.reserve(vertices.size());
+      for (std::size_t i : order) sorted_vertices.insert(sorted_vertices.end(), face(i), face(i) + stride);
+      vertices_[dim].swap(sorted_vertices);
+      sorted_vertices = std::vector<Vertex_handle>();
+      std::vector<Filtration_value> sorted_filtrations;
+      sorted_filtrations.reserve(order.size());
+      for (std::size_t i : order) sorted_filtrations.push_back(filtrations_[dim][i]);
+      filtrations_[dim].swap(sorted_filtrations);
+    }
+  }
+
+  /* \brief Returns the number of faces. */
+  std::size_t size() const {
+    std::size_t num_faces = 0;
+    for (auto const& filtrations : filtrations_) num_faces += filtrations.size();
+    return num_faces;
+  }
+
+  /* \brief Returns the range of all the faces in lexicographical order, which refers to this object.
+   *
+   * @pre `sort()` has been called, and every face of a face has been added. */
+  Face_range lexicographic_faces() const {
+    return Face_range(Face_iterator(this), Face_iterator());
+  }
+
+  /* \brief Forward iterator on the faces in lexicographical order, i.e. by a depth-first traversal: a face is
+   * followed by the faces of higher dimension it is a prefix of. */
+  class Face_iterator : public boost::iterator_facade<Face_iterator, Face const, boost::forward_traversal_tag,
+                                                      Face> {
+   public:
+    Face_iterator() : faces_(nullptr), dim_(0) {}
+
+    explicit Face_iterator(const Faces_by_dimension* faces)
+        : faces_(faces), next_(faces->vertices_.size(), 0), dim_(0) {
+      if (faces->filtrations_.empty() || faces->filtrations_[0].empty()) faces_ = nullptr;
+    }
+
+   private:
+    friend class boost::iterator_core_access;
+
+    Face dereference() const {
+      const Vertex_handle* face = faces_->vertices_[dim_].data() + next_[dim_] * (dim_ + 1);
+      return Face(boost::make_iterator_range(face, face + dim_ + 1), faces_->filtrations_[dim_][next_[dim_]]);
+    }
+
+    bool equal(const Face_iterator& other) const {
+      if (faces_ == nullptr || other.faces_ == nullptr) return faces_ == other.faces_;
+      return dim_ == other.dim_ && next_ == other.next_;
+    }
+
+    void increment() {
+      // The next face is the first coface of the current face, or else the next face with the same prefix as the
+      // current face or as one of its prefixes.
+      if (dim_ + 1 < next_.size() && is_prefix(dim_, next_[dim_], dim_ + 1)) {
+        ++dim_;
+        return;
+      }
+      ++next_[dim_];
+      for (; dim_ > 0; --dim_) {
+        if (is_prefix(dim_ - 1, next_[dim_ - 1], dim_)) return;
+        ++next_[dim_ - 1];
+      }
+      if (next_[0] == faces_->filtrations_[0].size()) faces_ = nullptr;
+    }
+
+    // Whether the face of index i in dimension dim is a prefix of the next face of dimension dim_coface.
+    bool is_prefix(std::size_t dim, std::size_t i, std::size_t dim_coface) const {
+      if (next_[dim_coface] == faces_->filtrations_[dim_coface].size()) return false;
+      const Vertex_handle* face = faces_->vertices_[dim].data() + i * (dim + 1);
+      return std::equal(face, face + dim + 1,
+                        faces_->vertices_[dim_coface].data() + next_[dim_coface] * (dim_coface + 1));
+    }
+
+    const Faces_by_dimension* faces_;
+    // The indices of the current face, of dimension dim_, and of its prefixes in the lower dimensions, and of the
+    // next faces to enumerate in the higher dimensions.
+    std::vector<std::size_t> next_;
+    std::size_t dim_;
+  };
+
+ private:
+  static std::size_t popcount(std::size_t mask) {
+    std::size_t count = 0;
+    for (; mask != 0; mask &= mask - 1) ++count;
+    return count;
+  }
+
+  template<typename InputIterator>
+  static std::size_t hash(InputIterator first, InputIterator last) {
+    std::size_t h = 0;
+    for (; first != last; ++first) h = (h ^ std::hash<Vertex_handle>()(*first)) * 0x100000001b3ULL;
+    // The table is indexed by the low bits, which the multiplications do not mix.
+    h = (h ^ (h >> 33)) * 0xff51afd7ed558ccdULL;
+    return h ^ (h >> 33);
+  }
+
+  // Rehashes the faces of dimension dim in a table of the given capacity, a power of 2.
+  void rehash(std::size_t dim, std::size_t capacity) {
+    std::vector<std::size_t>& table = tables_[dim];
+    table.assign(capacity, 0);
+    const std::size_t stride = dim + 1;
+    for (std::size_t i = 0; i < filtrations_[dim].size(); ++i) {
+      auto face = vertices_[dim].begin() + i * stride;
+      std::size_t slot = hash(face, face + stride) & (capacity - 1);
+      while (table[slot] != 0) slot = (slot + 1) & (capacity - 1);
+      table[slot] = i + 1;
+    }
+  }
+
+  // For each dimension, the vertices of the faces one after the other, and their filtration values.
+  std::vector<std::vector<Vertex_handle>> vertices_;
+  std::vector<std::vector<Filtration_value>> filtrations_;
+  // For each dimension, open addressing hash table of the faces, by index + 1, 0 for an empty slot.
+  std::vector<std::vector<std::size_t>> tables_;
+  // Buffers for add_faces_of_simplex: the vertices of the simplex and of a face, and the faces already added.
+  std::vector<Vertex_handle> simplex_;
+  std::vector<Vertex_handle> face_;
+  std::vector<std::size_t> present_;
+};
+
+/* \brief Whether SimplicialComplex can be constructed from faces sorted lexicographically, as `Simplex_tree`. */
+template<typename SimplicialComplex, typename Filtration_value>
+struct Is_constructible_from_sorted_faces
+    : std::is_constructible<SimplicialComplex, boost::container::ordered_unique_range_t,
+                            const typename Faces_by_dimension<typename SimplicialComplex::Vertex_handle,
+                                                              Filtration_value>::Face_range&> {};
+
+/* \brief Replaces complex, which must be empty, by the complex of the faces, built at once.
+ *
+ * @pre Every face of a face has been added. */
+template<typename SimplicialComplex, typename Filtration_value>
+void assign_faces(SimplicialComplex& complex,
+                  Faces_by_dimension<typename SimplicialComplex::Vertex_handle, Filtration_value>& faces,
+                  std::true_type) {
+  faces.sort();
+  complex = SimplicialComplex(boost::container::ordered_unique_range, faces.lexicographic_faces());
+}
+
+/* \brief Does nothing, the faces are inserted one by one in the complexes that cannot be built at once. */
+template<typename SimplicialComplex, typename Filtration_value>
+void assign_faces(SimplicialComplex&,
+                  Faces_by_dimension<typename SimplicialComplex::Vertex_handle, Filtration_value>&,
+                  std::false_type) {}
+
+}  // namespace alpha_complex
+
+}  // namespace Gudhi
+
+#endif  // ALPHA_COMPLEX_FACES_BY_DIMENSION_H_
@@ -20,6 +20,8 @@
 
 #include <gudhi/Debug_utils.h>
 #include <gudhi/Alpha_complex_options.h>
+#include <gudhi/Instrumentation.h>
+#include <gudhi/Alpha_complex/Faces_by_dimension.h>
 
 #include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
 #include <CGAL/Exact_predicates_exact_constructions_kernel.h>
@@ -45,6 +47,8 @@
 #include <unordered_map>
 #include <stdexcept>
 #include <cstddef>  // for std::size_t
+#include <algorithm>  // for std::sort, std::max
+#include <cmath>  // for std::fabs
 #include <memory>       // for std::unique_ptr
 #include <type_traits>  // for std::conditional and std::enable_if
 #include <limits>  // for numeric_limits<>
@@ -64,6 +68,9 @@ thread_local double RELATIVE_PRECISION_OF_TO_DOUBLE = 0.00001;
 //
 // FAST                         SAFE                         EXACT
 // CGAL::to_double(*iterator)   CGAL::to_double(*iterator)   CGAL::to_double(iterator->exact())
+//
+// FILTERED
+// CGAL::to_double(iterator->approx()), or CGAL::to_double(iterator->exact()) if the interval is too wide
 
 template <complexity Complexity>
 struct Value_from_iterator {
@@ -82,6 +89,19 @@ struct Value_from_iterator<complexity::EXACT> {
   }
 };
 
+template <>
+struct Value_from_iterator<complexity::FILTERED> {
+  template <typename Iterator>
+  static double perform(Iterator it) {
+    // The interval approximation is enough, unless it is too wide for the relative precision of CGAL::to_double.
+    auto const& approx = it->approx();
+    if (approx.sup() - approx.inf() <=
+        RELATIVE_PRECISION_OF_TO_DOUBLE * (std::max)(std::fabs(approx.inf()), std::fabs(approx.sup())))
+      return CGAL::to_double(approx);
+    return CGAL::to_double(it->exact());
+  }
+};
+
 /**
  * \class Alpha_complex_3d
  * \brief Alpha complex data structure for 3d specific case.
@@ -128,11 +148,21 @@ class Alpha_complex_3d {
   //
   // We could use Epick + CGAL::Tag_true for not weighted nor periodic, but during benchmark, we found a bug
   // https://github.com/CGAL/cgal/issues/3460
-  // This is the reason we only use Epick + CGAL::Tag_false, or Epeck
+  // This is the reason we only use Epick + CGAL::Tag_false, or Epeck, except for FILTERED with a CGAL version where
+  // this bug is fixed. Alpha values are then compared with intervals, and only exactly when these are not conclusive.
   //
-  // FAST                         SAFE                         EXACT
-  // Epick + CGAL::Tag_false      Epeck                        Epeck
-  using Predicates = typename std::conditional<(Complexity == complexity::FAST),
+  // FAST                         SAFE                         EXACT                        FILTERED
+  // Epick + CGAL::Tag_false      Epeck                        Epeck                        Epick + CGAL::Tag_true
+  //                                                                                        (Epeck if not available)
+#if CGAL_VERSION_NR >= 1041400000
+  static constexpr bool Exact_alpha_comparison = (Complexity == complexity::FILTERED) && !Weighted && !Periodic;
+#else
+  static constexpr bool Exact_alpha_comparison = false;
+#endif
+  using Exact_alpha_comparison_tag = typename std::conditional<Exact_alpha_comparison, CGAL::Tag_true,
+                                                               CGAL::Tag_false>::type;
+
+  using Predicates = typename std::conditional<(Complexity == complexity::FAST) || Exact_alpha_comparison,
                                                CGAL::Exact_predicates_inexact_constructions_kernel,
                                                CGAL::Exact_predicates_exact_constructions_kernel>::type;
 
@@ -162,7 +192,7 @@ class Alpha_complex_3d {
   using Tvb = typename std::conditional<Weighted, CGAL::Regular_triangulation_vertex_base_3<Kernel, TdsVb>,
                                         CGAL::Triangulation_vertex_base_3<Kernel, TdsVb>>::type;
 
-  using Vb = CGAL::Alpha_shape_vertex_base_3<Kernel, Tvb>;
+  using Vb = CGAL::Alpha_shape_vertex_base_3<Kernel, Tvb, Exact_alpha_comparison_tag>;
 
   using TdsCb = typename std::conditional<Periodic, CGAL::Periodic_3_triangulation_ds_cell_base_3<>,
                                           CGAL::Triangulation_ds_cell_base_3<>>::type;
@@ -170,7 +200,7 @@ class Alpha_complex_3d {
   using Tcb = typename std::conditional<Weighted, CGAL::Regular_triangulation_cell_base_3<Kernel, TdsCb>,
                                         CGAL::Triangulation_cell_base_3<Kernel, TdsCb>>::type;
 
-  using Cb = CGAL::Alpha_shape_cell_base_3<Kernel, Tcb>;
+  using Cb = CGAL::Alpha_shape_cell_base_3<Kernel, Tcb, Exact_alpha_comparison_tag>;
   using Tds = CGAL::Triangulation_data_structure_3<Vb, Cb>;
 
   // The other way to do a conditional type. Here there 4 possibilities, cannot use std::conditional
@@ -213,7 +243,7 @@ class Alpha_complex_3d {
    *
    *  The `Gudhi::alpha_complex::Alpha_complex_3d` is a wrapper on top of this class to ease the standard, weighted
    *  and/or periodic build of the Alpha complex 3d.*/
-  using Alpha_shape_3 = CGAL::Alpha_shape_3<Dt>;
+  using Alpha_shape_3 = CGAL::Alpha_shape_3<Dt, Exact_alpha_comparison_tag>;
 
   /** \brief The alpha values type.
    * Must be compatible with double. */
@@ -435,6 +465,7 @@ Weighted_alpha_complex_3d::Weighted_point_3 wp0(Weighted_alpha_complex_3d::Bare_
             typename Filtration_value = typename SimplicialComplexForAlpha3d::Filtration_value>
   bool create_complex(SimplicialComplexForAlpha3d& complex,
                       Filtration_value max_alpha_square = std::numeric_limits<Filtration_value>::infinity()) {
+    GUDHI_INSTRUMENT_SCOPE("Alpha_complex_3d::create_complex");
     if (complex.num_vertices() > 0) {
       std::cerr << "Alpha_complex_3d create_complex - complex is not empty\n";
       return false;  // ----- >>
@@ -442,6 +473,11 @@ Weighted_alpha_complex_3d::Weighted_point_3 wp0(Weighted_alpha_complex_3d::Bare_
 
     using Complex_vertex_handle = typename SimplicialComplexForAlpha3d::Vertex_handle;
     using Simplex_tree_vector_vertex = std::vector<Complex_vertex_handle>;
+    using Complex_filtration_value = typename SimplicialComplexForAlpha3d::Filtration_value;
+    // If the complex can be built at once from its simplices sorted lexicographically, they are collected instead of
+    // being inserted one by one, which saves a search in the complex for each of them.
+    using Bulk_build = Is_constructible_from_sorted_faces<SimplicialComplexForAlpha3d, Complex_filtration_value>;
+    Faces_by_dimension<Complex_vertex_handle, Complex_filtration_value> faces;
 
 #ifdef DEBUG_TRACES
     std::size_t count_vertices = 0;
@@ -540,7 +576,12 @@ Weighted_alpha_complex_3d::Weighted_point_3 wp0(Weighted_alpha_complex_3d::Bare_
 #ifdef DEBUG_TRACES
       std::clog << "filtration = " << filtr << std::endl;
 #endif  // DEBUG_TRACES
-      complex.insert_simplex(the_simplex, static_cast<Filtration_value>(filtr));
+      if (Bulk_build::value) {
+        std::sort(the_simplex.begin(), the_simplex.end());
+        faces.add_face(the_simplex, static_cast<Filtration_value>(filtr));
+      } else {
+        complex.insert_simplex(the_simplex, static_cast<Filtration_value>(filtr));
+      }
       GUDHI_CHECK(alpha_value_iterator != alpha_values.end(), "CGAL provided more simplices than values");
       ++alpha_value_iterator;
     }
@@ -551,6 +592,7 @@ Weighted_alpha_complex_3d::Weighted_point_3 wp0(Weighted_alpha_complex_3d::Bare_
     std::clog << "facets \t\t" << count_facets << std::endl;
     std::clog << "cells \t\t" << count_cells << std::endl;
 #endif  // DEBUG_TRACES
+    assign_faces(complex, faces, Bulk_build());
     // --------------------------------------------------------------------------------------------
     // As Alpha value is an approximation, we have to make filtration non decreasing while increasing the dimension
     complex.make_filtration_non_decreasing();
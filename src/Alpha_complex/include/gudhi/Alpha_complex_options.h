@@ -24,6 +24,8 @@ enum class complexity : char {
   FAST = 'f',   ///< Fast version.
   SAFE = 's',   ///< Safe version.
   EXACT = 'e',  ///< Exact version.
+  FILTERED = 'i',  ///< Fast version with interval arithmetic, where exact arithmetic is only used when intervals are
+                   ///< not conclusive.
 };
 
 }  // namespace alpha_complex
@@ -35,6 +35,8 @@ using Safe_alpha_complex_3d =
     Gudhi::alpha_complex::Alpha_complex_3d<Gudhi::alpha_complex::complexity::SAFE, false, false>;
 using Exact_alpha_complex_3d =
     Gudhi::alpha_complex::Alpha_complex_3d<Gudhi::alpha_complex::complexity::EXACT, false, false>;
+using Filtered_alpha_complex_3d =
+    Gudhi::alpha_complex::Alpha_complex_3d<Gudhi::alpha_complex::complexity::FILTERED, false, false>;
 
 template <typename Point>
 std::vector<Point> get_points() {
@@ -197,3 +199,60 @@ BOOST_AUTO_TEST_CASE(Alpha_complex_3d_from_points) {
     ++safe_sh;
   }
 }
+
+// Simplex_tree which cannot be built from sorted simplices, in which Alpha_complex_3d inserts the simplices one by one.
+struct Simplex_tree_without_sorted_construction : Gudhi::Simplex_tree<> {};
+
+BOOST_AUTO_TEST_CASE(Alpha_complex_3d_sorted_faces_construction) {
+  CGAL::Random random(11);
+  CGAL::Random_points_in_cube_3<Fast_alpha_complex_3d::Bare_point_3> in_cube(1., random);
+  std::vector<Fast_alpha_complex_3d::Bare_point_3> points;
+  for (int i = 0; i < 300; ++i) points.push_back(*in_cube++);
+  Fast_alpha_complex_3d alpha_complex(points);
+
+  Gudhi::Simplex_tree<> stree;
+  alpha_complex.create_complex(stree);
+  Simplex_tree_without_sorted_construction inserted_stree;
+  alpha_complex.create_complex(inserted_stree);
+  std::clog << "stree.num_simplices()=" << stree.num_simplices() << std::endl;
+  BOOST_CHECK(stree == inserted_stree);
+}
+
+BOOST_AUTO_TEST_CASE(Alpha_complex_3d_filtered_version) {
+  CGAL::Random random(7);
+  CGAL::Random_points_in_cube_3<Exact_alpha_complex_3d::Bare_point_3> in_cube(1., random);
+  std::vector<Exact_alpha_complex_3d::Bare_point_3> exact_points;
+  std::vector<Filtered_alpha_complex_3d::Bare_point_3> filtered_points;
+  for (int i = 0; i < 300; ++i) {
+    Exact_alpha_complex_3d::Bare_point_3 point = *in_cube++;
+    exact_points.push_back(point);
+    filtered_points.emplace_back(CGAL::to_double(point.x()), CGAL::to_double(point.y()), CGAL::to_double(point.z()));
+  }
+  Exact_alpha_complex_3d exact_alpha_complex(exact_points);
+  Gudhi::Simplex_tree<> exact_stree;
+  exact_alpha_complex.create_complex(exact_stree);
+  Filtered_alpha_complex_3d filtered_alpha_complex(filtered_points);
+  Gudhi::Simplex_tree<> filtered_stree;
+  filtered_alpha_complex.create_complex(filtered_stree);
+
+  std::clog << "Exact Alpha complex 3d num_simplices " << exact_stree.num_simplices() << " - Filtered is "
+            << filtered_stree.num_simplices() << std::endl;
+  BOOST_CHECK(exact_stree.num_simplices() == filtered_stree.num_simplices());
+  // Vertices are numbered in the order of the alpha shapes, so they are matched through their points.
+  std::vector<int> exact_vertex(filtered_points.size());
+  for (std::size_t vertex = 0; vertex < filtered_points.size(); ++vertex) {
+    std::size_t index = 0;
+    while (!(filtered_points[index] == filtered_alpha_complex.get_point(vertex))) ++index;
+    int exact = 0;
+    while (!(exact_alpha_complex.get_point(exact) == exact_points[index])) ++exact;
+    exact_vertex[vertex] = exact;
+  }
+  for (auto f_simplex : filtered_stree.complex_simplex_range()) {
+    std::vector<int> exact_simplex;
+    for (auto vertex : filtered_stree.simplex_vertex_range(f_simplex)) exact_simplex.push_back(exact_vertex[vertex]);
+    auto sh_exact = exact_stree.find(exact_simplex);
+    BOOST_CHECK(sh_exact != exact_stree.null_simplex());
+    if (sh_exact != exact_stree.null_simplex())
+      GUDHI_TEST_FLOAT_EQUALITY_CHECK(exact_stree.filtration(sh_exact), filtered_stree.filtration(f_simplex), 1e-5);
+  }
+}
@@ -27,6 +27,7 @@
 #include <gudhi/graph_simplicial_complex.h>
 #include <gudhi/Simplex_tree.h>
 #include <gudhi/Unitary_tests_utils.h>
+#include <gudhi/random_point_generators.h>
 
 // Use dynamic_dimension_tag for the user to be able to set dimension
 typedef CGAL::Epeck_d< CGAL::Dynamic_dimension_tag > Exact_kernel_d;
@@ -295,3 +296,60 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(Alpha_complex_with_duplicated_points, TestedKernel
       << std::endl;
   BOOST_CHECK(simplex_tree.num_vertices() < points.size());
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Alpha_complex_parallel_create_complex, TestedKernel, list_of_kernel_variants) {
+  std::clog << "========== Alpha_complex_parallel_create_complex ==========" << std::endl;
+  // 3 for the kernels with a static dimension
+  auto points = Gudhi::generate_points_in_cube_d<TestedKernel>(500, 3, 1.);
+  Gudhi::alpha_complex::Alpha_complex<TestedKernel> alpha_complex_from_points(points);
+
+  for (bool exact : {false, true}) {
+    Gudhi::Simplex_tree<> simplex_tree;
+    BOOST_CHECK(alpha_complex_from_points.create_complex(simplex_tree, 0.1, exact));
+    Gudhi::Simplex_tree<> parallel_simplex_tree;
+    BOOST_CHECK(alpha_complex_from_points.parallel_create_complex(parallel_simplex_tree, 0.1, exact));
+    std::clog << "simplex_tree.num_simplices()=" << simplex_tree.num_simplices() << std::endl;
+    // Same simplices with exactly the same filtration values.
+    BOOST_CHECK(simplex_tree == parallel_simplex_tree);
+  }
+}
+
+// Simplex_tree which cannot be built from sorted simplices, in which Alpha_complex inserts the full cells one by one.
+struct Simplex_tree_without_sorted_construction : Gudhi::Simplex_tree<> {};
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Alpha_complex_sorted_faces_construction, TestedKernel, list_of_kernel_variants) {
+  std::clog << "========== Alpha_complex_sorted_faces_construction ==========" << std::endl;
+  auto points = Gudhi::generate_points_in_cube_d<TestedKernel>(300, 3, 1.);
+  Gudhi::alpha_complex::Alpha_complex<TestedKernel> alpha_complex_from_points(points);
+
+  Gudhi::Simplex_tree<> simplex_tree;
+  BOOST_CHECK(alpha_complex_from_points.create_complex(simplex_tree));
+  Simplex_tree_without_sorted_construction inserted_simplex_tree;
+  BOOST_CHECK(alpha_complex_from_points.create_complex(inserted_simplex_tree));
+  std::clog << "simplex_tree.num_simplices()=" << simplex_tree.num_simplices() << std::endl;
+  BOOST_CHECK(simplex_tree == inserted_simplex_tree);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Alpha_complex_filtered_create_complex, TestedKernel, list_of_kernel_variants) {
+  std::clog << "========== Alpha_complex_filtered_create_complex ==========" << std::endl;
+  auto points = Gudhi::generate_points_in_cube_d<TestedKernel>(300, 3, 1.);
+  Gudhi::alpha_complex::Alpha_complex<TestedKernel> alpha_complex_from_points(points);
+
+  const double no_max = std::numeric_limits<double>::infinity();
+  for (bool exact : {false, true}) {
+    Gudhi::Simplex_tree<> simplex_tree;
+    BOOST_CHECK(alpha_complex_from_points.create_complex(simplex_tree, no_max, exact));
+    Gudhi::Simplex_tree<> filtered_simplex_tree;
+    BOOST_CHECK(alpha_complex_from_points.filtered_create_complex(filtered_simplex_tree, no_max, exact));
+    std::clog << "simplex_tree.num_simplices()=" << simplex_tree.num_simplices() << std::endl;
+    // Same simplices, with filtration values equal up to the relative precision of the filtered computation.
+    BOOST_CHECK(simplex_tree.num_simplices() == filtered_simplex_tree.num_simplices());
+    for (auto f_simplex : simplex_tree.complex_simplex_range()) {
+      auto filtered_simplex = filtered_simplex_tree.find(simplex_tree.simplex_vertex_range(f_simplex));
+      BOOST_CHECK(filtered_simplex != filtered_simplex_tree.null_simplex());
+      if (filtered_simplex != filtered_simplex_tree.null_simplex())
+        GUDHI_TEST_FLOAT_EQUALITY_CHECK(simplex_tree.filtration(f_simplex),
+                                        filtered_simplex_tree.filtration(filtered_simplex), 1e-5);
+    }
+  }
+}
@@ -0,0 +1,71 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Clément Maria
+ *
+ *    Copyright (C) 2020 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#include <gudhi/Bitmap_cubical_complex.h>
+#include <gudhi/Persistent_cohomology.h>
+#include <gudhi/Clock.h>
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <cstdlib>  // for std::atoi
+#include <cstddef>  // for std::size_t
+
+using Bitmap_base = Gudhi::cubical_complex::Bitmap_cubical_complex_base<double>;
+using Bitmap_fixed_dimension_base = Gudhi::cubical_complex::Bitmap_cubical_complex_fixed_dimension_base<double, 3>;
+using Field_Zp = Gudhi::persistent_cohomology::Field_Zp;
+
+template <typename Base>
+std::size_t benchmark(const char* name, const std::vector<unsigned>& sizes, const std::vector<double>& top_cells) {
+  using Cubical_complex = Gudhi::cubical_complex::Bitmap_cubical_complex<Base>;
+  std::clog << name << std::endl;
+  Gudhi::Clock construction("  Construction (lower star filtration and sort)");
+  Cubical_complex cubical_complex(sizes, top_cells);
+  construction.end();
+  std::clog << construction;
+
+  // Sum of the boundary elements, to keep the loop from being optimized away.
+  Gudhi::Clock boundaries("  Boundaries of all the cells");
+  std::size_t sum = 0;
+  for (std::size_t cell = 0; cell != cubical_complex.num_simplices(); ++cell)
+    for (auto face : cubical_complex.boundary_simplex_range(cell)) sum += face;
+  boundaries.end();
+  std::clog << boundaries << "    (checksum " << sum << ")" << std::endl;
+
+  Gudhi::Clock persistence("  Persistence");
+  Gudhi::persistent_cohomology::Persistent_cohomology<Cubical_complex, Field_Zp> pcoh(cubical_complex);
+  pcoh.init_coefficients(2);
+  pcoh.compute_persistent_cohomology();
+  persistence.end();
+  std::clog << persistence << "    " << pcoh.get_persistent_pairs().size() << " intervals" << std::endl;
+  return pcoh.get_persistent_pairs().size();
+}
+
+/*
+ * Compares Bitmap_cubical_complex_base and Bitmap_cubical_complex_fixed_dimension_base<double, 3> on a random 3D
+ * image, for the construction, the boundaries of all the cells and the persistence.
+ * Usage: cubical_complex_boundary_benchmark [size]
+ */
+int main(int argc, char * argv[]) {
+  unsigned size = 64;
+  if (argc == 2) size = std::atoi(argv[1]);
+  std::vector<unsigned> sizes(3, size);
+  std::vector<double> top_cells(std::size_t(size) * size * size);
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<double> value(0., 1.);
+  for (auto& v : top_cells) v = value(gen);
+  std::clog << "Random image of " << size << "^3 voxels" << std::endl;
+
+  std::size_t intervals = benchmark<Bitmap_base>("Bitmap_cubical_complex_base", sizes, top_cells);
+  if (benchmark<Bitmap_fixed_dimension_base>("Bitmap_cubical_complex_fixed_dimension_base", sizes, top_cells) !=
+      intervals)
+    std::cerr << "Different numbers of intervals" << std::endl;
+  return 0;
+}
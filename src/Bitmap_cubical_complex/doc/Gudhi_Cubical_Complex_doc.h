@@ -95,6 +95,21 @@ namespace cubical_complex {
  * from the file Bitmap_cubical_complex_periodic_boundary_conditions_base.h to construct cubical complex with periodic
  * boundary conditions. One can also use Perseus style input files (see \ref FileFormatsPerseus).
  *
+ * \section FixedDimension Dimension known at compile time
+ * When the dimension of the bitmap is known at compile time, Bitmap_cubical_complex_fixed_dimension_base can replace
+ * Bitmap_cubical_complex_base as the template parameter of Bitmap_cubical_complex. It stores the same bitmap, but
+ * computes the dimension, the boundary and the coboundary of a cell with loops of fixed length, into buffers given by
+ * the caller or containers of fixed capacity, without memory allocation. The lower star filtration is imposed by
+ * sequential traversals of the bitmap.
+ *
+ * \section ParallelPersistence Parallel persistence
+ * The persistence of a large image can be computed with
+ * `Persistent_cohomology<Bitmap_cubical_complex<...>, Field_Zp, Chunk_reduction>`, see
+ * Gudhi::persistent_cohomology::Chunk_reduction. The boundary matrix is split into chunks of cells consecutive in the
+ * filtration, whose pairs are computed in parallel, and the few cells paired across chunks are then processed
+ * together. The persistence diagram is the same as with the default reduction. In Python, this is
+ * `CubicalComplex.persistence(in_chunks=True)`.
+ *
  * \section BitmapExamples Examples
  * End user programs are available in example/Bitmap_cubical_complex and utilities/Bitmap_cubical_complex folders.
  * 
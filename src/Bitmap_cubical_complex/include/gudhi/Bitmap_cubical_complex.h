@@ -13,6 +13,7 @@
 
 #include <gudhi/Bitmap_cubical_complex_base.h>
 #include <gudhi/Bitmap_cubical_complex_periodic_boundary_conditions_base.h>
+#include <gudhi/Bitmap_cubical_complex_fixed_dimension_base.h>
 
 #ifdef GUDHI_USE_TBB
 #include <tbb/parallel_sort.h>
@@ -228,10 +229,11 @@ class Bitmap_cubical_complex : public T {
   //*********************************************//
 
   /**
-   * Boundary_simplex_range class provides ranges for boundary iterators.
+   * Boundary_simplex_range class provides ranges for boundary iterators. It is the Boundary_range of the template
+   * parameter, a std::vector or a container of fixed capacity.
    **/
-  typedef typename std::vector<Simplex_handle>::iterator Boundary_simplex_iterator;
-  typedef typename std::vector<Simplex_handle> Boundary_simplex_range;
+  typedef typename T::Boundary_range Boundary_simplex_range;
+  typedef typename Boundary_simplex_range::iterator Boundary_simplex_iterator;
 
   /**
    * Filtration_simplex_iterator class provides an iterator though the whole structure in the order of filtration.
@@ -339,7 +341,7 @@ class Bitmap_cubical_complex : public T {
    * boundary_simplex_range creates an object of a Boundary_simplex_range class
    * that provides ranges for the Boundary_simplex_iterator.
    **/
-  Boundary_simplex_range boundary_simplex_range(Simplex_handle sh) { return this->get_boundary_of_a_cell(sh); }
+  Boundary_simplex_range boundary_simplex_range(Simplex_handle sh) { return this->boundary_range(sh); }
 
   /**
    * filtration_simplex_range creates an object of a Filtration_simplex_range class
@@ -368,7 +370,7 @@ class Bitmap_cubical_complex : public T {
    * Function needed for compatibility with Gudhi. Not useful for other purposes.
    **/
   std::pair<Simplex_handle, Simplex_handle> endpoints(Simplex_handle sh) {
-    std::vector<std::size_t> bdry = this->get_boundary_of_a_cell(sh);
+    Boundary_simplex_range bdry = this->boundary_range(sh);
     if (globalDbg) {
       std::clog << "std::pair<Simplex_handle, Simplex_handle> endpoints( Simplex_handle sh )\n";
       std::clog << "bdry.size() : " << bdry.size() << "\n";
@@ -0,0 +1,247 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Clément Maria
+ *
+ *    Copyright (C) 2020 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef BITMAP_CUBICAL_COMPLEX_FIXED_DIMENSION_BASE_H_
+#define BITMAP_CUBICAL_COMPLEX_FIXED_DIMENSION_BASE_H_
+
+#include <gudhi/Bitmap_cubical_complex_base.h>
+
+#include <boost/container/static_vector.hpp>
+
+#include <array>
+#include <vector>
+#include <algorithm>  // for std::min
+#include <stdexcept>
+#include <cstddef>
+
+namespace Gudhi {
+
+namespace cubical_complex {
+
+/**
+ * @brief Cubical complex represented as a bitmap, whose dimension is known at compile time.
+ * @ingroup cubical_complex
+ * @details This class stores the same bitmap as Bitmap_cubical_complex_base, and can replace it as the template
+ * parameter of Bitmap_cubical_complex. The strides of the Dimension directions in the bitmap are stored in an array,
+ * so that the loops that compute the dimension, the boundary and the coboundary of a cell have a fixed number of
+ * iterations. The boundary and the coboundary are written in a buffer given by the caller, or returned in a
+ * container of fixed capacity, without any memory allocation. The cells are in the same order as in
+ * Bitmap_cubical_complex_base, so are the elements of their boundaries and coboundaries.
+ */
+template <typename T, unsigned Dimension>
+class Bitmap_cubical_complex_fixed_dimension_base : public Bitmap_cubical_complex_base<T> {
+  static_assert(Dimension > 0, "The dimension of a bitmap must be positive.");
+
+ public:
+  /** Maximal number of elements in the boundary or the coboundary of a cell. */
+  static const std::size_t max_boundary_size = 2 * Dimension;
+
+  /**
+   * Default constructor.
+   **/
+  Bitmap_cubical_complex_fixed_dimension_base() {}
+  /**
+   * Constructor of an empty bitmap with sizes[i] top dimensional cells in the i-th direction.
+   * @exception std::invalid_argument In case sizes does not have Dimension elements.
+   **/
+  Bitmap_cubical_complex_fixed_dimension_base(const std::vector<unsigned>& sizes)
+      : Bitmap_cubical_complex_base<T>(check_dimension(sizes)) {
+    set_up_strides();
+  }
+  /**
+   * Constructor from a Perseus style file.
+   * @exception std::invalid_argument In case the dimension of the bitmap in the file is not Dimension.
+   **/
+  Bitmap_cubical_complex_fixed_dimension_base(const char* perseus_style_file)
+      : Bitmap_cubical_complex_base<T>(perseus_style_file) {
+    check_dimension(this->sizes);
+    set_up_strides();
+  }
+  /**
+   * Constructor from the numbers of top dimensional cells in every direction, and the filtration values of the top
+   * dimensional cells, in lexicographical order. The filtration of the other cells is the lower star filtration.
+   * @exception std::invalid_argument In case dimensions does not have Dimension elements, or top_dimensional_cells
+   * does not have as many elements as there are top dimensional cells.
+   **/
+  Bitmap_cubical_complex_fixed_dimension_base(const std::vector<unsigned>& dimensions,
+                                              const std::vector<T>& top_dimensional_cells)
+      : Bitmap_cubical_complex_base<T>(check_dimension(dimensions)) {
+    set_up_strides();
+    std::size_t number_of_top_dimensional_cells = 1;
+    for (unsigned size : dimensions) number_of_top_dimensional_cells *= size;
+    if (number_of_top_dimensional_cells != top_dimensional_cells.size())
+      throw std::invalid_argument("The number of top dimensional cells does not match the sizes of the bitmap.");
+    std::size_t index = 0;
+    for_each_cell([&](std::size_t cell, const std::array<std::size_t, Dimension>& counter) {
+      for (unsigned i = 0; i != Dimension; ++i)
+        if (counter[i] % 2 == 0) return;
+      this->data[cell] = top_dimensional_cells[index++];
+    });
+    impose_lower_star_filtration();
+  }
+
+  virtual ~Bitmap_cubical_complex_fixed_dimension_base() {}
+
+  /**
+   * Writes the boundary of a cell in boundary, which must have room for max_boundary_size elements, and returns the
+   * number of elements written. They are in the order of `Bitmap_cubical_complex_base::get_boundary_of_a_cell`, so that
+   * the incidence coefficients are alternating.
+   */
+  std::size_t get_boundary_of_a_cell(std::size_t cell, std::size_t* boundary) const {
+    std::array<std::size_t, Dimension> counter = compute_counter(cell);
+    std::size_t size = 0;
+    std::size_t sum_of_dimensions = 0;
+    for (unsigned i = Dimension; i != 0; --i) {
+      if (counter[i - 1] % 2 == 1) {
+        if (sum_of_dimensions % 2) {
+          boundary[size++] = cell + strides_[i - 1];
+          boundary[size++] = cell - strides_[i - 1];
+        } else {
+          boundary[size++] = cell - strides_[i - 1];
+          boundary[size++] = cell + strides_[i - 1];
+        }
+        ++sum_of_dimensions;
+      }
+    }
+    return size;
+  }
+
+  /**
+   * Writes the coboundary of a cell in coboundary, which must have room for max_boundary_size elements, and returns
+   * the number of elements written. They are in the order of `Bitmap_cubical_complex_base::get_coboundary_of_a_cell`.
+   */
+  std::size_t get_coboundary_of_a_cell(std::size_t cell, std::size_t* coboundary) const {
+    std::array<std::size_t, Dimension> counter = compute_counter(cell);
+    std::size_t size = 0;
+    for (unsigned i = Dimension; i != 0; --i) {
+      if (counter[i - 1] % 2 == 0) {
+        if (counter[i - 1] != 0) coboundary[size++] = cell - strides_[i - 1];
+        if (counter[i - 1] != extents_[i - 1]) coboundary[size++] = cell + strides_[i - 1];
+      }
+    }
+    return size;
+  }
+
+  virtual std::vector<std::size_t> get_boundary_of_a_cell(std::size_t cell) const override {
+    std::size_t boundary[max_boundary_size];
+    return std::vector<std::size_t>(boundary, boundary + get_boundary_of_a_cell(cell, boundary));
+  }
+
+  virtual std::vector<std::size_t> get_coboundary_of_a_cell(std::size_t cell) const override {
+    std::size_t coboundary[max_boundary_size];
+    return std::vector<std::size_t>(coboundary, coboundary + get_coboundary_of_a_cell(cell, coboundary));
+  }
+
+  /**
+   * Returns the dimension of a cell.
+   */
+  unsigned get_dimension_of_a_cell(std::size_t cell) const {
+    std::array<std::size_t, Dimension> counter = compute_counter(cell);
+    unsigned dimension = 0;
+    for (unsigned i = 0; i != Dimension; ++i) dimension += counter[i] % 2;
+    return dimension;
+  }
+
+  /**
+   * Container of the boundary or the coboundary of a cell, with a fixed capacity.
+   **/
+  typedef boost::container::static_vector<std::size_t, max_boundary_size> Boundary_range;
+  typedef typename Boundary_range::const_iterator Boundary_iterator;
+  typedef Boundary_range Coboundary_range;
+  typedef Boundary_iterator Coboundary_iterator;
+
+  /**
+   * Returns the boundary of a cell, in the order of get_boundary_of_a_cell, without memory allocation.
+   **/
+  Boundary_range boundary_range(std::size_t cell) const {
+    Boundary_range boundary(max_boundary_size);
+    boundary.resize(get_boundary_of_a_cell(cell, boundary.data()));
+    return boundary;
+  }
+
+  /**
+   * Returns the coboundary of a cell, in the order of get_coboundary_of_a_cell, without memory allocation.
+   **/
+  Coboundary_range coboundary_range(std::size_t cell) const {
+    Coboundary_range coboundary(max_boundary_size);
+    coboundary.resize(get_coboundary_of_a_cell(cell, coboundary.data()));
+    return coboundary;
+  }
+
+  /**
+   * Same as `Bitmap_cubical_complex_base::impose_lower_star_filtration`: the filtration value of a cell becomes the
+   * minimum of its value and of the values of its cofaces. The cells are processed by decreasing dimension, in a
+   * sequential traversal of the bitmap per dimension.
+   **/
+  void impose_lower_star_filtration() {
+    for (unsigned dimension = Dimension; dimension-- != 0;) {
+      for_each_cell([&](std::size_t cell, const std::array<std::size_t, Dimension>& counter) {
+        unsigned cell_dimension = 0;
+        for (unsigned i = 0; i != Dimension; ++i) cell_dimension += counter[i] % 2;
+        if (cell_dimension != dimension) return;
+        T value = this->data[cell];
+        for (unsigned i = 0; i != Dimension; ++i) {
+          if (counter[i] % 2 == 0) {
+            if (counter[i] != 0) value = (std::min)(value, this->data[cell - strides_[i]]);
+            if (counter[i] != extents_[i]) value = (std::min)(value, this->data[cell + strides_[i]]);
+          }
+        }
+        this->data[cell] = value;
+      });
+    }
+  }
+
+ private:
+  static const std::vector<unsigned>& check_dimension(const std::vector<unsigned>& sizes) {
+    if (sizes.size() != Dimension)
+      throw std::invalid_argument("The dimension of the bitmap does not match the template parameter Dimension.");
+    return sizes;
+  }
+
+  void set_up_strides() {
+    for (unsigned i = 0; i != Dimension; ++i) {
+      strides_[i] = this->multipliers[i];
+      extents_[i] = 2 * static_cast<std::size_t>(this->sizes[i]);
+    }
+  }
+
+  // Coordinates of a cell in the bitmap, between 0 and extents_[i] in the i-th direction.
+  std::array<std::size_t, Dimension> compute_counter(std::size_t cell) const {
+    std::array<std::size_t, Dimension> counter;
+    for (unsigned i = Dimension - 1; i != 0; --i) {
+      counter[i] = cell / strides_[i];
+      cell -= counter[i] * strides_[i];
+    }
+    // strides_[0] is 1
+    counter[0] = cell;
+    return counter;
+  }
+
+  // Calls f(cell, counter) on the cells in the order of the bitmap, the counter being updated incrementally.
+  template <typename Function>
+  void for_each_cell(Function&& f) const {
+    std::array<std::size_t, Dimension> counter{};
+    for (std::size_t cell = 0; cell != this->data.size(); ++cell) {
+      f(cell, counter);
+      for (unsigned i = 0; i != Dimension && ++counter[i] > extents_[i]; ++i) counter[i] = 0;
+    }
+  }
+
+  std::array<std::size_t, Dimension> strides_;
+  std::array<std::size_t, Dimension> extents_;
+};
+
+}  // namespace cubical_complex
+
+namespace Cubical_complex = cubical_complex;
+
+}  // namespace Gudhi
+
+#endif  // BITMAP_CUBICAL_COMPLEX_FIXED_DIMENSION_BASE_H_
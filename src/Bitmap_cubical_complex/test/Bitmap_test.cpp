@@ -15,12 +15,17 @@
 #include <gudhi/reader_utils.h>
 #include <gudhi/Bitmap_cubical_complex.h>
 #include <gudhi/Persistent_cohomology.h>
+#include <gudhi/Zero_dimensional_persistence.h>
 
 // standard stuff
 #include <iostream>
 #include <sstream>
 #include <vector>
 #include <limits>
+#include <random>
+#include <stdexcept>
+#include <tuple>
+#include <algorithm>
 
 typedef Gudhi::cubical_complex::Bitmap_cubical_complex_base<double> Bitmap_cubical_complex_base;
 typedef Gudhi::cubical_complex::Bitmap_cubical_complex<Bitmap_cubical_complex_base> Bitmap_cubical_complex;
@@ -30,6 +35,11 @@ typedef Gudhi::cubical_complex::Bitmap_cubical_complex_periodic_boundary_conditi
 typedef Gudhi::cubical_complex::Bitmap_cubical_complex<Bitmap_cubical_complex_periodic_boundary_conditions_base>
     Bitmap_cubical_complex_periodic_boundary_conditions;
 
+typedef Gudhi::cubical_complex::Bitmap_cubical_complex_fixed_dimension_base<double, 3>
+    Bitmap_cubical_complex_fixed_dimension_base;
+typedef Gudhi::cubical_complex::Bitmap_cubical_complex<Bitmap_cubical_complex_fixed_dimension_base>
+    Bitmap_cubical_complex_fixed_dimension;
+
 BOOST_AUTO_TEST_CASE(check_dimension) {
   std::vector<double> increasingFiltrationOfTopDimensionalCells({1, 2, 3, 4, 5, 6, 7, 8, 9});
 
@@ -1579,3 +1589,112 @@ BOOST_AUTO_TEST_CASE(perseus_file_read) {
   std::clog << "Second value of sinusoid.txt is " << value << std::endl;
   BOOST_CHECK(value == std::numeric_limits<double>::infinity());
 }
+
+BOOST_AUTO_TEST_CASE(fixed_dimension_base_same_as_base) {
+  std::vector<unsigned> sizes({4, 3, 5});
+  std::vector<double> data(60);
+  std::mt19937 gen(1);
+  std::uniform_int_distribution<int> value(0, 9);
+  for (auto& v : data) v = value(gen);
+  Bitmap_cubical_complex ba(sizes, data);
+  Bitmap_cubical_complex_fixed_dimension fixed(sizes, data);
+  BOOST_CHECK(ba.num_simplices() == fixed.num_simplices());
+  for (std::size_t cell = 0; cell != ba.num_simplices(); ++cell) {
+    BOOST_CHECK(ba.get_cell_data(cell) == fixed.get_cell_data(cell));
+    BOOST_CHECK(ba.get_dimension_of_a_cell(cell) == fixed.get_dimension_of_a_cell(cell));
+    BOOST_CHECK(ba.key(cell) == fixed.key(cell));
+    std::vector<std::size_t> boundary = ba.get_boundary_of_a_cell(cell);
+    Bitmap_cubical_complex_fixed_dimension::Boundary_simplex_range fixed_boundary = fixed.boundary_simplex_range(cell);
+    BOOST_CHECK(std::vector<std::size_t>(fixed_boundary.begin(), fixed_boundary.end()) == boundary);
+    std::vector<std::size_t> coboundary = ba.get_coboundary_of_a_cell(cell);
+    std::size_t buffer[Bitmap_cubical_complex_fixed_dimension_base::max_boundary_size];
+    std::size_t coboundary_size = fixed.get_coboundary_of_a_cell(cell, buffer);
+    BOOST_CHECK(std::vector<std::size_t>(buffer, buffer + coboundary_size) == coboundary);
+  }
+
+  Gudhi::persistent_cohomology::Persistent_cohomology<Bitmap_cubical_complex, Gudhi::persistent_cohomology::Field_Zp>
+      pcoh(ba);
+  pcoh.init_coefficients(2);
+  pcoh.compute_persistent_cohomology();
+  Gudhi::persistent_cohomology::Persistent_cohomology<Bitmap_cubical_complex_fixed_dimension,
+                                                      Gudhi::persistent_cohomology::Field_Zp> fixed_pcoh(fixed);
+  fixed_pcoh.init_coefficients(2);
+  fixed_pcoh.compute_persistent_cohomology();
+  std::ostringstream diagram, fixed_diagram;
+  pcoh.output_diagram(diagram);
+  fixed_pcoh.output_diagram(fixed_diagram);
+  BOOST_CHECK(diagram.str() == fixed_diagram.str());
+
+  BOOST_CHECK_THROW(Bitmap_cubical_complex_fixed_dimension(std::vector<unsigned>({4, 15}), data),
+                    std::invalid_argument);
+  BOOST_CHECK_THROW(Bitmap_cubical_complex_fixed_dimension(sizes, std::vector<double>(59)), std::invalid_argument);
+}
+
+template <typename Cubical_complex, typename Reduction>
+std::vector<std::tuple<int, double, double>> sorted_diagram(Cubical_complex& cubical_complex, int coefficient) {
+  Gudhi::persistent_cohomology::Persistent_cohomology<Cubical_complex, Gudhi::persistent_cohomology::Field_Zp,
+                                                      Reduction> pcoh(cubical_complex, true);
+  pcoh.init_coefficients(coefficient);
+  pcoh.compute_persistent_cohomology();
+  std::vector<std::tuple<int, double, double>> diagram;
+  for (auto& interval : pcoh.get_persistent_pairs()) {
+    diagram.emplace_back(cubical_complex.dimension(std::get<0>(interval)),
+                         cubical_complex.filtration(std::get<0>(interval)),
+                         cubical_complex.filtration(std::get<1>(interval)));
+  }
+  std::sort(diagram.begin(), diagram.end());
+  return diagram;
+}
+
+BOOST_AUTO_TEST_CASE(chunk_reduction_same_diagram) {
+  using Gudhi::persistent_cohomology::Annotation_matrix_reduction;
+  using Gudhi::persistent_cohomology::Chunk_reduction;
+  std::mt19937 gen(1);
+  // Few distinct values, i.e. many cells with the same filtration value, and distinct values.
+  for (int num_values : {4, 1000000}) {
+    std::uniform_int_distribution<int> value(0, num_values - 1);
+    std::vector<unsigned> sizes({12, 10, 11});
+    std::vector<double> data(12 * 10 * 11);
+    for (auto& v : data) v = value(gen);
+    Bitmap_cubical_complex b(sizes, data);
+    Bitmap_cubical_complex_periodic_boundary_conditions periodic_b(sizes, data, std::vector<bool>(3, true));
+    for (int coefficient : {2, 3}) {
+      auto diagram = sorted_diagram<Bitmap_cubical_complex, Annotation_matrix_reduction>(b, coefficient);
+      BOOST_CHECK(diagram == (sorted_diagram<Bitmap_cubical_complex, Chunk_reduction>(b, coefficient)));
+      auto periodic_diagram = sorted_diagram<Bitmap_cubical_complex_periodic_boundary_conditions,
+                                             Annotation_matrix_reduction>(periodic_b, coefficient);
+      BOOST_CHECK(periodic_diagram == (sorted_diagram<Bitmap_cubical_complex_periodic_boundary_conditions,
+                                                      Chunk_reduction>(periodic_b, coefficient)));
+      std::clog << diagram.size() << " and " << periodic_diagram.size() << " intervals with Z/" << coefficient
+                << "Z coefficients\n";
+    }
+  }
+}
+
+template <class Cubical_complex>
+void test_zero_dimensional_persistence(Cubical_complex& cubical_complex) {
+  auto expected = sorted_diagram<Cubical_complex, Gudhi::persistent_cohomology::Annotation_matrix_reduction>(
+      cubical_complex, 2);
+  expected.erase(std::remove_if(expected.begin(), expected.end(),
+                                [](const std::tuple<int, double, double>& i) { return std::get<0>(i) != 0; }),
+                 expected.end());
+  Gudhi::persistent_cohomology::Zero_dimensional_persistence<double> zero_pers(cubical_complex);
+  zero_pers.compute_persistence();
+  std::vector<std::tuple<int, double, double>> diagram;
+  for (auto& interval : zero_pers.intervals()) diagram.emplace_back(0, interval.first, interval.second);
+  std::sort(diagram.begin(), diagram.end());
+  std::clog << diagram.size() << " intervals of dimension 0\n";
+  BOOST_CHECK(diagram == expected);
+}
+
+BOOST_AUTO_TEST_CASE(zero_dimensional_persistence_same_diagram) {
+  std::mt19937 gen(2);
+  std::uniform_int_distribution<int> value(0, 9);
+  std::vector<unsigned> sizes({12, 10, 11});
+  std::vector<double> data(12 * 10 * 11);
+  for (auto& v : data) v = value(gen);
+  Bitmap_cubical_complex b(sizes, data);
+  test_zero_dimensional_persistence(b);
+  Bitmap_cubical_complex_periodic_boundary_conditions periodic_b(sizes, data, std::vector<bool>(3, true));
+  test_zero_dimensional_persistence(periodic_b);
+}
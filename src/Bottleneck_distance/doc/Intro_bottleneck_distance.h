@@ -61,6 +61,18 @@ int main() {
  *
  * \image html bottleneck_distance_example.png The point (0, 13) is at distance 6.5 from the diagonal and more specifically from the point (6.5, 6.5)
  *
+ * With `e = 0`, the exact distance is one of the distances between the points that are not larger than the largest
+ * distance between a point and the diagonal. These candidates are not sorted: the search only selects the ones it
+ * tries, with `std::nth_element`.
+ *
+ * `bottleneck_distance_matrix()` computes the distances between all the pairs of diagrams of a range, in parallel if
+ * TBB is available, and extracts the points of each diagram only once.
+ *
+ * When only a comparison with a threshold is needed, for instance in a nearest neighbor search among diagrams,
+ * `bottleneck_distance_less_than()` computes a single matching instead of the distance. The cheap bounds of
+ * `bottleneck_distance_lower_bound()` and `bottleneck_distance_upper_bound()` can also be used to discard diagrams
+ * before any matching.
+ *
  * \section bottleneckbasicexample Basic example
  *
  * This other example computes the bottleneck distance from 2 persistence diagrams:
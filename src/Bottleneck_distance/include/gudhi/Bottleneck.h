@@ -17,7 +17,14 @@
 
 #include <CGAL/version.h>  // for CGAL_VERSION_NR
 
+#include <boost/range/size.hpp>
+
+#ifdef GUDHI_USE_TBB
+#include <tbb/parallel_for.h>
+#endif
+
 #include <vector>
+#include <cstddef>
 #include <algorithm>  // for max
 #include <limits>  // for numeric_limits
 
@@ -64,7 +71,10 @@ inline double bottleneck_distance_approx(Persistence_graph& g, double e) {
 }
 
 inline double bottleneck_distance_exact(Persistence_graph& g) {
-  std::vector<double> sd = g.sorted_distances();
+  // The candidates are not sorted. Before each step, the candidates of rank lower_bound_i to upper_bound_i are between
+  // these two indices, and std::nth_element puts the one of rank step at its place, the smaller ones before and the
+  // larger ones after.
+  std::vector<double> sd = g.candidate_distances();
   long lower_bound_i = 0;
   long upper_bound_i = sd.size() - 1;
   const double alpha = std::pow(g.size(), 1. / 5.);
@@ -72,6 +82,7 @@ inline double bottleneck_distance_exact(Persistence_graph& g) {
   Graph_matching biggest_unperfect(g);
   while (lower_bound_i != upper_bound_i) {
     long step = lower_bound_i + static_cast<long> ((upper_bound_i - lower_bound_i - 1) / alpha);
+    std::nth_element(sd.begin() + lower_bound_i, sd.begin() + step, sd.begin() + upper_bound_i + 1);
     m.set_r(sd.at(step));
     while (m.multi_augment()) {}  // compute a maximum matching (in the graph corresponding to the current r)
     if (m.perfect()) {
@@ -85,6 +96,12 @@ inline double bottleneck_distance_exact(Persistence_graph& g) {
   return sd.at(lower_bound_i);
 }
 
+inline double bottleneck_distance_of_graph(Persistence_graph& g, double e) {
+  if (g.bottleneck_alive() == std::numeric_limits<double>::infinity())
+    return std::numeric_limits<double>::infinity();
+  return (std::max)(g.bottleneck_alive(), e == 0. ? bottleneck_distance_exact(g) : bottleneck_distance_approx(g, e));
+}
+
 /** \brief Function to compute the Bottleneck distance between two persistence diagrams.
  *
  * \tparam Persistence_diagram1,Persistence_diagram2
@@ -112,9 +129,109 @@ template<typename Persistence_diagram1, typename Persistence_diagram2>
 double bottleneck_distance(const Persistence_diagram1 &diag1, const Persistence_diagram2 &diag2,
                            double e = (std::numeric_limits<double>::min)()) {
   Persistence_graph g(diag1, diag2, e);
-  if (g.bottleneck_alive() == std::numeric_limits<double>::infinity())
-    return std::numeric_limits<double>::infinity();
-  return (std::max)(g.bottleneck_alive(), e == 0. ? bottleneck_distance_exact(g) : bottleneck_distance_approx(g, e));
+  return bottleneck_distance_of_graph(g, e);
+}
+
+/** \brief Function to check whether the Bottleneck distance between two persistence diagrams is smaller than a
+ * threshold.
+ *
+ * The distance is not computed: if the bounds of `bottleneck_distance_lower_bound()` and
+ * `bottleneck_distance_upper_bound()` do not answer, a single maximum matching is computed, with the pairs of points
+ * at distance smaller than `t`.
+ *
+ * \tparam Persistence_diagram1,Persistence_diagram2
+ * models of the concept `PersistenceDiagram`.
+ *
+ * \param[in] diag1 The first persistence diagram.
+ * \param[in] diag2 The second persistence diagram.
+ * \param[in] t The threshold.
+ *
+ * \return Whether the exact Bottleneck distance is strictly smaller than `t`.
+ *
+ * \ingroup bottleneck_distance
+ */
+template<typename Persistence_diagram1, typename Persistence_diagram2>
+bool bottleneck_distance_less_than(const Persistence_diagram1 &diag1, const Persistence_diagram2 &diag2, double t) {
+  Persistence_graph g(diag1, diag2, 0.);
+  if (!(g.bottleneck_alive() < t) || !(g.finite_distance_lower_bound() < t))
+    return false;
+  if (g.finite_distance_upper_bound() < t)
+    return true;
+  Graph_matching m(g);
+  // The distances are doubles, the ones smaller than t are the ones not larger than its predecessor.
+  m.set_r(std::nextafter(t, -std::numeric_limits<double>::infinity()));
+  while (m.multi_augment()) {}  // compute a maximum matching (in the graph corresponding to the current r)
+  return m.perfect();
+}
+
+/** \brief Function to compute a lower bound on the Bottleneck distance between two persistence diagrams.
+ *
+ * The distances to the diagonal of two matched points differ by at most their distance. This returns the largest
+ * difference between the k-th largest distances to the diagonal in the two diagrams, and the distance between the
+ * points at infinity, in \f$O(n \log n)\f$.
+ *
+ * \tparam Persistence_diagram1,Persistence_diagram2
+ * models of the concept `PersistenceDiagram`.
+ *
+ * \ingroup bottleneck_distance
+ */
+template<typename Persistence_diagram1, typename Persistence_diagram2>
+double bottleneck_distance_lower_bound(const Persistence_diagram1 &diag1, const Persistence_diagram2 &diag2) {
+  Persistence_graph g(diag1, diag2, 0.);
+  return (std::max)(g.bottleneck_alive(), g.finite_distance_lower_bound());
+}
+
+/** \brief Function to compute an upper bound on the Bottleneck distance between two persistence diagrams.
+ *
+ * This returns the largest distance between a point and the diagonal, which is the cost of matching all the points
+ * with the diagonal, and the distance between the points at infinity, in \f$O(n)\f$.
+ *
+ * \tparam Persistence_diagram1,Persistence_diagram2
+ * models of the concept `PersistenceDiagram`.
+ *
+ * \ingroup bottleneck_distance
+ */
+template<typename Persistence_diagram1, typename Persistence_diagram2>
+double bottleneck_distance_upper_bound(const Persistence_diagram1 &diag1, const Persistence_diagram2 &diag2) {
+  Persistence_graph g(diag1, diag2, 0.);
+  return (std::max)(g.bottleneck_alive(), g.finite_distance_upper_bound());
+}
+
+/** \brief Function to compute the Bottleneck distances between all the pairs of persistence diagrams of a range.
+ *
+ * The result is the same as calling `bottleneck_distance()` on every pair of diagrams, but the points of each diagram
+ * are extracted only once, and the pairs are processed in parallel if TBB is available.
+ *
+ * \tparam PersistenceDiagramRange a random access range of models of the concept `PersistenceDiagram`.
+ *
+ * \param[in] diagrams The persistence diagrams.
+ * \param[in] e Same as in `bottleneck_distance()`.
+ *
+ * \return The symmetric matrix of the distances, as a vector of rows.
+ *
+ * \ingroup bottleneck_distance
+ */
+template<typename PersistenceDiagramRange>
+std::vector<std::vector<double>> bottleneck_distance_matrix(const PersistenceDiagramRange &diagrams,
+                                                            double e = (std::numeric_limits<double>::min)()) {
+  const std::size_t n = boost::size(diagrams);
+  std::vector<Persistence_graph::Diagram_points> points(n);
+  auto extract = [&](std::size_t i) { points[i] = Persistence_graph::diagram_points(*(std::begin(diagrams) + i), e); };
+  std::vector<std::vector<double>> distances(n, std::vector<double>(n, 0.));
+  auto compute_row = [&](std::size_t i) {
+    for (std::size_t j = i + 1; j < n; ++j) {
+      Persistence_graph g(points[i], points[j]);
+      distances[i][j] = distances[j][i] = bottleneck_distance_of_graph(g, e);
+    }
+  };
+#ifdef GUDHI_USE_TBB
+  tbb::parallel_for(std::size_t(0), n, extract);
+  tbb::parallel_for(std::size_t(0), n, compute_row);
+#else
+  for (std::size_t i = 0; i < n; ++i) extract(i);
+  for (std::size_t i = 0; i < n; ++i) compute_row(i);
+#endif
+  return distances;
 }
 
 }  // namespace persistence_diagram
@@ -20,6 +20,9 @@
 #include <vector>
 #include <algorithm>
 #include <limits>  // for numeric_limits
+#include <cmath>  // for std::fabs
+#include <functional>  // for std::greater
+#include <cstddef>
 
 namespace Gudhi {
 
@@ -32,9 +35,21 @@ namespace persistence_diagram {
  */
 class Persistence_graph {
  public:
+  /** \internal \brief Points of a persistence diagram used by the graph: the finite points whose persistence is
+   * larger than e, and the sorted births of the infinite points. */
+  struct Diagram_points {
+    std::vector<Internal_point> finite;
+    std::vector<double> alive;
+  };
+  /** \internal \brief Extracts the points of a PersistenceDiagram (concept), so that they can be used in several
+   * graphs. */
+  template<typename Persistence_diagram>
+  static Diagram_points diagram_points(const Persistence_diagram& diag, double e);
   /** \internal \brief Constructor taking 2 PersistenceDiagrams (concept) as parameters. */
   template<typename Persistence_diagram1, typename Persistence_diagram2>
   Persistence_graph(const Persistence_diagram1& diag1, const Persistence_diagram2& diag2, double e);
+  /** \internal \brief Constructor taking the points of 2 persistence diagrams, extracted with the same e. */
+  Persistence_graph(const Diagram_points& diag1, const Diagram_points& diag2);
   /** \internal \brief Is the given point from U the projection of a point in V ? */
   bool on_the_u_diagonal(int u_point_index) const;
   /** \internal \brief Is the given point from V the projection of a point in U ? */
@@ -51,6 +66,15 @@ class Persistence_graph {
   double bottleneck_alive() const;
   /** \internal \brief Returns the O(n^2) sorted distances between the points. */
   std::vector<double> sorted_distances() const;
+  /** \internal \brief Returns, in no particular order, the distances between the points that are not larger than the
+   * largest distance between a point and its projection, for which the matching is perfect. */
+  std::vector<double> candidate_distances() const;
+  /** \internal \brief Returns the largest distance between a finite point and the diagonal, an upper bound on the
+   * bottleneck distance between the finite points of the diagrams (matching all of them with their projections). */
+  double finite_distance_upper_bound() const;
+  /** \internal \brief Returns the largest difference between the k-th largest distances to the diagonal in both
+   * diagrams, a lower bound on the bottleneck distance between the finite points of the diagrams. */
+  double finite_distance_lower_bound() const;
   /** \internal \brief Returns an upper bound for the diameter of the convex hull of all non infinite points */
   double diameter_bound() const;
   /** \internal \brief Returns the corresponding internal point */
@@ -64,32 +88,32 @@ class Persistence_graph {
   double b_alive;
 };
 
-template<typename Persistence_diagram1, typename Persistence_diagram2>
-Persistence_graph::Persistence_graph(const Persistence_diagram1 &diag1,
-                                     const Persistence_diagram2 &diag2, double e)
-    : u(), v(), b_alive(0.) {
-  std::vector<double> u_alive;
-  std::vector<double> v_alive;
-  for (auto it = std::begin(diag1); it != std::end(diag1); ++it) {
-    if (std::get<1>(*it) == std::numeric_limits<double>::infinity())
-      u_alive.push_back(std::get<0>(*it));
-    else if (std::get<1>(*it) - std::get<0>(*it) > e)
-      u.push_back(Internal_point(std::get<0>(*it), std::get<1>(*it), u.size()));
-  }
-  for (auto it = std::begin(diag2); it != std::end(diag2); ++it) {
+template<typename Persistence_diagram>
+Persistence_graph::Diagram_points Persistence_graph::diagram_points(const Persistence_diagram &diag, double e) {
+  Diagram_points points;
+  for (auto it = std::begin(diag); it != std::end(diag); ++it) {
     if (std::get<1>(*it) == std::numeric_limits<double>::infinity())
-      v_alive.push_back(std::get<0>(*it));
+      points.alive.push_back(std::get<0>(*it));
     else if (std::get<1>(*it) - std::get<0>(*it) > e)
-      v.push_back(Internal_point(std::get<0>(*it), std::get<1>(*it), v.size()));
+      points.finite.push_back(Internal_point(std::get<0>(*it), std::get<1>(*it), points.finite.size()));
   }
+  std::sort(points.alive.begin(), points.alive.end());
+  return points;
+}
+
+template<typename Persistence_diagram1, typename Persistence_diagram2>
+Persistence_graph::Persistence_graph(const Persistence_diagram1 &diag1,
+                                     const Persistence_diagram2 &diag2, double e)
+    : Persistence_graph(diagram_points(diag1, e), diagram_points(diag2, e)) { }
+
+inline Persistence_graph::Persistence_graph(const Diagram_points &diag1, const Diagram_points &diag2)
+    : u(diag1.finite), v(diag2.finite), b_alive(0.) {
   if (u.size() < v.size())
     swap(u, v);
-  std::sort(u_alive.begin(), u_alive.end());
-  std::sort(v_alive.begin(), v_alive.end());
-  if (u_alive.size() != v_alive.size()) {
+  if (diag1.alive.size() != diag2.alive.size()) {
     b_alive = std::numeric_limits<double>::infinity();
   } else {
-    for (auto it_u = u_alive.cbegin(), it_v = v_alive.cbegin(); it_u != u_alive.cend(); ++it_u, ++it_v)
+    for (auto it_u = diag1.alive.cbegin(), it_v = diag2.alive.cbegin(); it_u != diag1.alive.cend(); ++it_u, ++it_v)
       b_alive = (std::max)(b_alive, std::fabs(*it_u - *it_v));
   }
 }
@@ -144,6 +168,46 @@ inline std::vector<double> Persistence_graph::sorted_distances() const {
   return distances;
 }
 
+inline std::vector<double> Persistence_graph::candidate_distances() const {
+  const double max_distance = finite_distance_upper_bound();
+  std::vector<double> distances;
+  distances.push_back(0.);  // for empty diagrams
+  for (int u_point_index = 0; u_point_index < size(); ++u_point_index) {
+    for (int v_point_index = 0; v_point_index < size(); ++v_point_index) {
+      double d = distance(u_point_index, v_point_index);
+      if (d <= max_distance) distances.push_back(d);
+    }
+  }
+  return distances;
+}
+
+inline double Persistence_graph::finite_distance_upper_bound() const {
+  double max_distance = 0.;
+  for (int u_point_index = 0; u_point_index < size(); ++u_point_index)
+    max_distance = (std::max)(max_distance, distance(u_point_index, corresponding_point_in_v(u_point_index)));
+  return max_distance;
+}
+
+inline double Persistence_graph::finite_distance_lower_bound() const {
+  // The distances to the diagonal of two matched points differ by at most their distance, and a point matched with
+  // the diagonal is like a point at distance 0 from it. Matching the sorted distances is optimal in dimension 1.
+  auto distances_to_diagonal = [](const std::vector<Internal_point>& points) {
+    std::vector<double> distances;
+    distances.reserve(points.size());
+    for (const Internal_point& p : points) distances.push_back((p.y() - p.x()) / 2.);
+    std::sort(distances.begin(), distances.end(), std::greater<double>());
+    return distances;
+  };
+  std::vector<double> u_distances = distances_to_diagonal(u);
+  std::vector<double> v_distances = distances_to_diagonal(v);
+  // u has at least as many points as v
+  double max_difference = 0.;
+  for (std::size_t i = 0; i < u_distances.size(); ++i)
+    max_difference = (std::max)(max_difference,
+                                std::fabs(u_distances[i] - (i < v_distances.size() ? v_distances[i] : 0.)));
+  return max_difference;
+}
+
 inline Internal_point Persistence_graph::get_u_point(int u_point_index) const {
   if (!on_the_u_diagonal(u_point_index))
     return u.at(u_point_index);
@@ -154,3 +154,59 @@ BOOST_AUTO_TEST_CASE(global) {
   BOOST_CHECK(bottleneck_distance(v1, v2, upper_bound / 10000.) <= upper_bound / 100. + upper_bound / 10000.);
   BOOST_CHECK(std::abs(bottleneck_distance(v1, v2, 0.) - bottleneck_distance(v1, v2, upper_bound / 10000.)) <= upper_bound / 10000.);
 }
+
+BOOST_AUTO_TEST_CASE(distance_matrix) {
+  std::uniform_real_distribution<double> unif1(0., upper_bound);
+  std::default_random_engine re;
+  std::vector<std::vector< std::pair<double, double> >> diags(6);
+  for (std::size_t d = 0; d < diags.size(); d++) {
+    for (std::size_t i = 0; i < 10 * d; i++) {
+      double a = unif1(re);
+      double b = unif1(re);
+      diags[d].emplace_back(std::min(a, b), std::max(a, b));
+    }
+  }
+  diags[2].emplace_back(1., std::numeric_limits<double>::infinity());
+  diags[3].emplace_back(2., std::numeric_limits<double>::infinity());
+  std::vector<std::vector<double>> exact = bottleneck_distance_matrix(diags, 0.);
+  std::vector<std::vector<double>> approx = bottleneck_distance_matrix(diags);
+  BOOST_CHECK(exact.size() == diags.size());
+  for (std::size_t i = 0; i < diags.size(); i++) {
+    BOOST_CHECK(exact[i].size() == diags.size());
+    BOOST_CHECK(exact[i][i] == 0.);
+    for (std::size_t j = 0; j < diags.size(); j++) {
+      if (i == j) continue;
+      BOOST_CHECK(exact[i][j] == bottleneck_distance(diags[i], diags[j], 0.));
+      BOOST_CHECK(approx[i][j] == bottleneck_distance(diags[i], diags[j]));
+    }
+  }
+  BOOST_CHECK(exact[0][2] == std::numeric_limits<double>::infinity());
+  BOOST_CHECK(exact[2][3] >= 1.);
+}
+
+BOOST_AUTO_TEST_CASE(threshold_and_bounds) {
+  std::uniform_real_distribution<double> unif1(0., upper_bound);
+  std::uniform_real_distribution<double> unif2(upper_bound / 10000., upper_bound / 100.);
+  std::default_random_engine re;
+  for (int n = 0; n < 40; n += 3) {
+    std::vector< std::pair<double, double> > v1, v2;
+    for (int i = 0; i < n; i++) {
+      double a = unif1(re);
+      double b = unif1(re);
+      v1.emplace_back(std::min(a, b), std::max(a, b));
+      if (i % 4 != 0)
+        v2.emplace_back(std::min(a, b) + unif2(re), std::max(a, b) + unif2(re));
+    }
+    double b = bottleneck_distance(v1, v2, 0.);
+    BOOST_CHECK(bottleneck_distance_lower_bound(v1, v2) <= b);
+    BOOST_CHECK(bottleneck_distance_upper_bound(v1, v2) >= b);
+    BOOST_CHECK(!bottleneck_distance_less_than(v1, v2, b));
+    BOOST_CHECK(bottleneck_distance_less_than(v1, v2, std::nextafter(b, upper_bound)));
+    BOOST_CHECK(!bottleneck_distance_less_than(v1, v2, b / 2.));
+    BOOST_CHECK(bottleneck_distance_less_than(v1, v2, 2. * b + 1.));
+  }
+  std::vector< std::pair<double, double> > v1 = {{0., 1.}, {2., std::numeric_limits<double>::infinity()}};
+  std::vector< std::pair<double, double> > v2 = {{0., 1.}};
+  BOOST_CHECK(!bottleneck_distance_less_than(v1, v2, upper_bound));
+  BOOST_CHECK(bottleneck_distance_lower_bound(v1, v2) == std::numeric_limits<double>::infinity());
+}
@@ -86,7 +86,7 @@ int main(int argc, char* argv[]) {
   std::clog << "Current path is : " << full_path << std::endl;
 
   std::clog << "File name;Radius;Rips time;Cech time; Ratio Rips/Cech time;Rips nb simplices;Cech nb simplices;"
-            << std::endl;
+            << "Incremental Cech time;Speedup;Parallel incremental Cech time;Speedup;" << std::endl;
   boost::filesystem::directory_iterator end_itr;  // default construction yields past-the-end
   for (boost::filesystem::directory_iterator itr(boost::filesystem::current_path()); itr != end_itr; ++itr) {
     if (!boost::filesystem::is_directory(itr->status())) {
@@ -122,7 +122,23 @@ int main(int argc, char* argv[]) {
 
           assert(rips_stree.num_simplices() >= cech_stree.num_simplices());
           std::clog << rips_stree.num_simplices() << ";";
-          std::clog << cech_stree.num_simplices() << ";" << std::endl;
+          std::clog << cech_stree.num_simplices() << ";";
+
+          // Same complex, with the minimal enclosing balls computed from the ones of the facets
+          Gudhi::Clock incremental_clock("Incremental Cech computation");
+          Simplex_tree incremental_stree;
+          cech_complex_from_points.create_complex_incremental(incremental_stree, p0.size() - 1);
+          double incremental_sec = incremental_clock.num_seconds();
+          std::clog << incremental_sec << ";" << cech_sec / incremental_sec << ";";
+
+          Gudhi::Clock parallel_clock("Parallel incremental Cech computation");
+          Simplex_tree parallel_stree;
+          cech_complex_from_points.create_complex_incremental(parallel_stree, p0.size() - 1, true);
+          double parallel_sec = parallel_clock.num_seconds();
+          std::clog << parallel_sec << ";" << cech_sec / parallel_sec << ";" << std::endl;
+
+          assert(incremental_stree.num_simplices() == cech_stree.num_simplices());
+          assert(parallel_stree.num_simplices() == cech_stree.num_simplices());
         }
       }
     }
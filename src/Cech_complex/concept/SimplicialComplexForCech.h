@@ -42,6 +42,24 @@ struct SimplicialComplexForCech {
   template< typename Blocker >
   void expansion_with_blockers(int max_dim, Blocker block_simplex);
 
+  /** \brief Same as `expansion_with_blockers`, where the simplices of a given dimension may be vetted concurrently.
+   * Only required by `Cech_complex::create_complex_incremental`. */
+  template< typename Blocker >
+  void parallel_expansion_with_blockers(int max_dim, Blocker block_simplex);
+
+  /** Key associated to each simplex. Only required by `Cech_complex::create_complex_incremental`. */
+  typedef unspecified Simplex_key;
+
+  /** Stores a key in a simplex. Only required by `Cech_complex::create_complex_incremental`. */
+  void assign_key(Simplex_handle simplex, Simplex_key key);
+
+  /** Returns the key of a simplex. Only required by `Cech_complex::create_complex_incremental`. */
+  Simplex_key key(Simplex_handle simplex);
+
+  /** \brief Returns a range over the facets of a simplex. Only required by
+   * `Cech_complex::create_complex_incremental`. */
+  Boundary_simplex_range boundary_simplex_range(Simplex_handle simplex);
+
   /** Returns the number of vertices in the simplicial complex. */
   std::size_t num_vertices();
 
@@ -70,6 +70,12 @@ namespace cech_complex {
  * This radius computation is the reason why the Cech_complex is taking much more time to be computed than the
  * \ref rips_complex but it offers more topological guarantees.
  *
+ * `Cech_complex::create_complex_incremental` builds the same complex, but caches the minimal enclosing ball of every
+ * simplex of dimension 2 and more, at the index given by its key. The ball of a simplex is the one of a facet if it
+ * contains the opposite vertex, and otherwise the ball circumscribed to the simplex, so that Miniball is only called
+ * in degenerate cases. The expansion can also be done in parallel, one dimension at a time, with
+ * `Simplex_tree::parallel_expansion_with_blockers`.
+ *
  * If the Cech_complex interfaces are not detailed enough for your need, please refer to
  * <a href="_cech_complex_2cech_complex_step_by_step_8cpp-example.html">
  * cech_complex_step_by_step.cpp</a> example, where the graph construction over the Simplex_tree is more detailed.
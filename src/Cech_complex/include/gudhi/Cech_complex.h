@@ -14,7 +14,7 @@
 #include <gudhi/distance_functions.h>        // for Gudhi::Minimal_enclosing_ball_radius
 #include <gudhi/graph_simplicial_complex.h>  // for Gudhi::Proximity_graph
 #include <gudhi/Debug_utils.h>               // for GUDHI_CHECK
-#include <gudhi/Cech_complex_blocker.h>      // for Gudhi::cech_complex::Cech_blocker
+#include <gudhi/Cech_complex_blocker.h>      // for Gudhi::cech_complex::Cech_blocker, Cech_incremental_blocker
 
 #include <iostream>
 #include <stdexcept>  // for exception management
@@ -97,6 +97,40 @@ class Cech_complex {
                                     Cech_blocker<SimplicialComplexForCechComplex, Cech_complex>(&complex, this));
   }
 
+  /** \brief Same as `create_complex()`, except that the minimal enclosing ball of a simplex is computed from the ones
+   * of its facets, which are cached during the expansion.
+   *
+   * If the minimal enclosing ball of a facet contains the opposite vertex, it is the one of the simplex. Otherwise,
+   * it is the ball circumscribed to the simplex in its affine hull, that is computed by solving a linear system of
+   * the size of the simplex dimension. Miniball is only used in degenerate cases.
+   * The simplices are the same as the ones of `create_complex()`, as the radius of a simplex is computed again by
+   * Miniball when it is within a relative distance of 1e-8 of `max_radius()`. The filtration values are the same,
+   * up to rounding errors.
+   *
+   * @param[in] complex SimplicialComplexForCech to be created. Its simplices must store keys, that are used as
+   * indices in the cache, and are assigned to the simplices of dimension 2 and more.
+   * @param[in] dim_max graph expansion until this given maximal dimension.
+   * @param[in] parallel If true, the complex is expanded with `parallel_expansion_with_blockers`, and the balls of
+   * the simplices of a given dimension are computed in parallel if TBB is available.
+   * @exception std::invalid_argument In debug mode, if `complex.num_vertices()` does not return 0.
+   *
+   */
+  template <typename SimplicialComplexForCechComplex>
+  void create_complex_incremental(SimplicialComplexForCechComplex& complex, int dim_max, bool parallel = false) {
+    GUDHI_CHECK(complex.num_vertices() == 0,
+                std::invalid_argument("Cech_complex::create_complex_incremental - simplicial complex is not empty"));
+
+    // insert the proximity graph in the simplicial complex
+    complex.insert_graph(cech_skeleton_graph_);
+    Enclosing_ball_storage<Coordinate> balls(point_cloud_.empty() ? 0 : point_cloud_[0].size());
+    Cech_incremental_blocker<SimplicialComplexForCechComplex, Cech_complex> blocker(&complex, this, &balls);
+    // expand the graph until dimension dim_max
+    if (parallel)
+      complex.parallel_expansion_with_blockers(dim_max, blocker);
+    else
+      complex.expansion_with_blockers(dim_max, blocker);
+  }
+
   /** @return max_radius value given at construction. */
   Filtration_value max_radius() const { return max_radius_; }
 
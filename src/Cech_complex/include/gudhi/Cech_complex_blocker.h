@@ -12,10 +12,19 @@
 #define CECH_COMPLEX_BLOCKER_H_
 
 #include <gudhi/distance_functions.h>  // for Gudhi::Minimal_enclosing_ball_radius
+#include <gudhi/Miniball.hpp>
+
+#ifdef GUDHI_USE_TBB
+#include <tbb/concurrent_vector.h>
+#endif
 
 #include <iostream>
 #include <vector>
 #include <cmath>  // for std::sqrt
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <algorithm>  // for std::max
 
 namespace Gudhi {
 
@@ -72,6 +81,238 @@ class Cech_blocker {
   Cech_complex* cc_ptr_;
 };
 
+/** \internal
+ * \class Enclosing_ball_storage
+ * \brief Minimal enclosing balls of simplices, as a squared radius followed by the coordinates of the center, indexed
+ * by the keys of the simplices.
+ *
+ * \details With TBB, balls can be added while others are added or read concurrently.
+ */
+template <typename Coordinate>
+class Enclosing_ball_storage {
+ public:
+  explicit Enclosing_ball_storage(std::size_t ambient_dimension) : stride_(ambient_dimension + 1) {}
+
+  /** \internal \brief Adds a ball with uninitialized values and returns its index. */
+  std::size_t add() {
+#ifdef GUDHI_USE_TBB
+    return static_cast<std::size_t>(balls_.grow_by(stride_) - balls_.begin()) / stride_;
+#else
+    balls_.resize(balls_.size() + stride_);
+    return balls_.size() / stride_ - 1;
+#endif
+  }
+
+  Coordinate& squared_radius(std::size_t index) { return balls_[index * stride_]; }
+  Coordinate& center(std::size_t index, std::size_t coordinate) { return balls_[index * stride_ + 1 + coordinate]; }
+
+ private:
+  std::size_t stride_;
+#ifdef GUDHI_USE_TBB
+  tbb::concurrent_vector<Coordinate> balls_;
+#else
+  std::vector<Coordinate> balls_;
+#endif
+};
+
+/** \internal
+ * \class Cech_incremental_blocker
+ * \brief Čech complex blocker that computes the minimal enclosing ball of a simplex from the ones of its facets.
+ *
+ * \ingroup cech_complex
+ *
+ * \details
+ * The minimal enclosing balls of the simplices of dimension 2 and more are stored in an Enclosing_ball_storage, at
+ * the index given by the key of the simplex. If the ball of a facet contains the opposite vertex, it is the ball of
+ * the simplex. Otherwise all the vertices are on the boundary of the minimal enclosing ball of the simplex, which is
+ * the ball circumscribed to the simplex in its affine hull. If its center is not in the simplex because of rounding
+ * errors, or if the simplex is degenerate, the ball is computed by Miniball. The ball is also computed by Miniball
+ * when its radius is within a relative distance of 1e-8 of the Cech_complex max_radius, so that the simplices
+ * blocked are the ones blocked by Cech_blocker.
+ *
+ * The blocker only reads the facets of the simplex it is called on, and writes the key and the filtration value of
+ * this simplex, so that it can be used with `parallel_expansion_with_blockers`.
+ *
+ * \tparam SimplicialComplexForCech furnishes `Simplex_handle`, `Vertex_handle`, `Simplex_key` and `Filtration_value`
+ * type definitions, and `simplex_vertex_range(Simplex_handle sh)`, `boundary_simplex_range(Simplex_handle sh)`,
+ * `key(Simplex_handle sh)`, `assign_key(Simplex_handle sh, Simplex_key key)` and
+ * `assign_filtration(Simplex_handle sh, Filtration_value filt)` methods.
+ *
+ * \tparam Cech_complex is required by the blocker.
+ */
+template <typename SimplicialComplexForCech, typename Cech_complex>
+class Cech_incremental_blocker {
+ private:
+  using Point = typename Cech_complex::Point;
+  using Point_cloud = typename Cech_complex::Point_cloud;
+  using Coordinate = typename Point::value_type;
+  using Ball_storage = Enclosing_ball_storage<Coordinate>;
+
+  using Simplex_handle = typename SimplicialComplexForCech::Simplex_handle;
+  using Simplex_key = typename SimplicialComplexForCech::Simplex_key;
+  using Vertex_handle = typename SimplicialComplexForCech::Vertex_handle;
+  using Filtration_value = typename SimplicialComplexForCech::Filtration_value;
+
+ public:
+  /** \internal \brief Čech complex blocker operator() - the oracle - computes and stores the minimal enclosing ball of
+   * the simplex, assigns the filtration value from its radius and returns if the simplex expansion must be blocked.
+   *  \param[in] sh The Simplex_handle of a simplex of dimension at least 2.
+   *  \return true if the simplex radius is greater than the Cech_complex max_radius*/
+  bool operator()(Simplex_handle sh) {
+    std::size_t index = balls_ptr_->add();
+    sc_ptr_->assign_key(sh, static_cast<Simplex_key>(index));
+    if (!copy_ball_of_a_facet(sh, index) && !circumscribed_ball(sh, index)) miniball(sh, index);
+    Filtration_value radius = std::sqrt(balls_ptr_->squared_radius(index));
+    // Close to max_radius, the rounding errors of the incremental computation could change the blocking decision,
+    // the ball is computed again by Miniball, as by Cech_blocker.
+    if (std::fabs(radius - cc_ptr_->max_radius()) <= threshold_tolerance * cc_ptr_->max_radius()) {
+      miniball(sh, index);
+      radius = std::sqrt(balls_ptr_->squared_radius(index));
+    }
+    sc_ptr_->assign_filtration(sh, radius);
+    return (radius > cc_ptr_->max_radius());
+  }
+
+  /** \internal \brief Čech complex incremental blocker constructor. */
+  Cech_incremental_blocker(SimplicialComplexForCech* sc_ptr, Cech_complex* cc_ptr, Ball_storage* balls_ptr)
+      : sc_ptr_(sc_ptr), cc_ptr_(cc_ptr), balls_ptr_(balls_ptr) {}
+
+ private:
+  // Relative distance to max_radius under which the radius is computed by Miniball.
+  static constexpr Coordinate threshold_tolerance = 1e-8;
+
+  // Looks for a facet whose ball contains the opposite vertex, and copies its ball at index if there is one.
+  bool copy_ball_of_a_facet(Simplex_handle sh, std::size_t index) {
+    // The opposite vertex of a facet is the difference of the sums of the vertices.
+    std::uintmax_t sum_of_vertices = 0;
+    int dimension = -1;
+    for (auto vertex : sc_ptr_->simplex_vertex_range(sh)) {
+      sum_of_vertices += vertex;
+      ++dimension;
+    }
+    for (auto facet : sc_ptr_->boundary_simplex_range(sh)) {
+      std::uintmax_t opposite = sum_of_vertices;
+      for (auto vertex : sc_ptr_->simplex_vertex_range(facet)) opposite -= vertex;
+      const Point& point = cc_ptr_->get_point(static_cast<Vertex_handle>(opposite));
+      if (dimension == 2) {
+        // The ball of an edge is not stored, the point is in it iff the edge is seen from it with an angle >= 90°.
+        auto vertex_it = sc_ptr_->simplex_vertex_range(facet).begin();
+        const Point& p1 = cc_ptr_->get_point(*vertex_it);
+        const Point& p2 = cc_ptr_->get_point(*++vertex_it);
+        Coordinate dot = 0;
+        for (std::size_t i = 0; i < point.size(); ++i) dot += (p1[i] - point[i]) * (p2[i] - point[i]);
+        if (dot <= 0) {
+          Coordinate squared_radius = 0;
+          for (std::size_t i = 0; i < point.size(); ++i) {
+            balls_ptr_->center(index, i) = (p1[i] + p2[i]) / 2;
+            squared_radius += (p1[i] - p2[i]) * (p1[i] - p2[i]);
+          }
+          balls_ptr_->squared_radius(index) = squared_radius / 4;
+          return true;
+        }
+      } else {
+        std::size_t facet_index = sc_ptr_->key(facet);
+        Coordinate squared_distance = 0;
+        for (std::size_t i = 0; i < point.size(); ++i) {
+          Coordinate diff = balls_ptr_->center(facet_index, i) - point[i];
+          squared_distance += diff * diff;
+        }
+        if (squared_distance <= balls_ptr_->squared_radius(facet_index)) {
+          balls_ptr_->squared_radius(index) = balls_ptr_->squared_radius(facet_index);
+          for (std::size_t i = 0; i < point.size(); ++i)
+            balls_ptr_->center(index, i) = balls_ptr_->center(facet_index, i);
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  // Computes the ball circumscribed to the simplex in its affine hull, and stores it at index if its center is in the
+  // simplex, i.e. if it is the minimal enclosing ball.
+  bool circumscribed_ball(Simplex_handle sh, std::size_t index) {
+    std::vector<const Point*> points;
+    for (auto vertex : sc_ptr_->simplex_vertex_range(sh)) points.push_back(&cc_ptr_->get_point(vertex));
+    const Point& origin = *points.back();
+    const std::size_t ambient_dimension = origin.size();
+    const std::size_t k = points.size() - 1;
+    if (k > ambient_dimension) return false;
+    // With u_i = p_i - p_k, the center is p_k + sum lambda_j u_j where sum lambda_j <u_i,u_j> = |u_i|^2 / 2.
+    // system is the k x (k+1) augmented matrix of these equations.
+    std::vector<Coordinate> system(k * (k + 1));
+    Coordinate scale = 0;
+    for (std::size_t i = 0; i < k; ++i) {
+      for (std::size_t j = 0; j <= i; ++j) {
+        Coordinate dot = 0;
+        for (std::size_t c = 0; c < ambient_dimension; ++c)
+          dot += ((*points[i])[c] - origin[c]) * ((*points[j])[c] - origin[c]);
+        system[i * (k + 1) + j] = dot;
+        system[j * (k + 1) + i] = dot;
+      }
+      system[i * (k + 1) + k] = system[i * (k + 1) + i] / 2;
+      scale = (std::max)(scale, system[i * (k + 1) + i]);
+    }
+    // Gaussian elimination with partial pivoting
+    for (std::size_t col = 0; col < k; ++col) {
+      std::size_t pivot = col;
+      for (std::size_t row = col + 1; row < k; ++row)
+        if (std::fabs(system[row * (k + 1) + col]) > std::fabs(system[pivot * (k + 1) + col])) pivot = row;
+      if (!(std::fabs(system[pivot * (k + 1) + col]) > scale * std::numeric_limits<Coordinate>::epsilon()))
+        return false;
+      if (pivot != col)
+        for (std::size_t c = col; c <= k; ++c) std::swap(system[pivot * (k + 1) + c], system[col * (k + 1) + c]);
+      for (std::size_t row = col + 1; row < k; ++row) {
+        Coordinate factor = system[row * (k + 1) + col] / system[col * (k + 1) + col];
+        for (std::size_t c = col; c <= k; ++c) system[row * (k + 1) + c] -= factor * system[col * (k + 1) + c];
+      }
+    }
+    std::vector<Coordinate> lambda(k);
+    Coordinate lambda_origin = 1;
+    for (std::size_t row = k; row-- > 0;) {
+      Coordinate value = system[row * (k + 1) + k];
+      for (std::size_t c = row + 1; c < k; ++c) value -= system[row * (k + 1) + c] * lambda[c];
+      lambda[row] = value / system[row * (k + 1) + row];
+      // The barycentric coordinates of the center must be non-negative.
+      if (!(lambda[row] >= 0)) return false;
+      lambda_origin -= lambda[row];
+    }
+    if (!(lambda_origin >= 0)) return false;
+    for (std::size_t c = 0; c < ambient_dimension; ++c) {
+      Coordinate coordinate = origin[c];
+      for (std::size_t i = 0; i < k; ++i) coordinate += lambda[i] * ((*points[i])[c] - origin[c]);
+      balls_ptr_->center(index, c) = coordinate;
+    }
+    // All the points are on the sphere up to rounding errors, take the largest distance so that the ball contains them.
+    Coordinate squared_radius = 0;
+    for (const Point* point : points) {
+      Coordinate squared_distance = 0;
+      for (std::size_t c = 0; c < ambient_dimension; ++c) {
+        Coordinate diff = balls_ptr_->center(index, c) - (*point)[c];
+        squared_distance += diff * diff;
+      }
+      squared_radius = (std::max)(squared_radius, squared_distance);
+    }
+    balls_ptr_->squared_radius(index) = squared_radius;
+    return true;
+  }
+
+  void miniball(Simplex_handle sh, std::size_t index) {
+    using Point_iterator = typename Point_cloud::const_iterator;
+    using Coordinate_iterator = typename Point::const_iterator;
+    using Min_sphere = Miniball::Miniball<Miniball::CoordAccessor<Point_iterator, Coordinate_iterator>>;
+
+    Point_cloud points;
+    for (auto vertex : sc_ptr_->simplex_vertex_range(sh)) points.push_back(cc_ptr_->get_point(vertex));
+    Min_sphere ms(points.front().size(), points.begin(), points.end());
+    for (std::size_t i = 0; i < points.front().size(); ++i) balls_ptr_->center(index, i) = ms.center()[i];
+    balls_ptr_->squared_radius(index) = ms.squared_radius();
+  }
+
+  SimplicialComplexForCech* sc_ptr_;
+  Cech_complex* cc_ptr_;
+  Ball_storage* balls_ptr_;
+};
+
 }  // namespace cech_complex
 
 }  // namespace Gudhi
@@ -17,6 +17,7 @@
 #include <string>
 #include <vector>
 #include <algorithm>  // std::max
+#include <random>
 
 #include <gudhi/Cech_complex.h>
 // to construct Cech_complex from a OFF file of points
@@ -227,6 +228,76 @@ BOOST_AUTO_TEST_CASE(Cech_complex_from_points) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(Cech_complex_incremental_same_as_miniball) {
+  // Points on a sphere, with cospherical subsets, and random points
+  Point_cloud points;
+  for (double x : {-1., 0., 1.})
+    for (double y : {-1., 0., 1.})
+      for (double z : {-1., 0., 1.}) points.push_back({x, y, z});
+  std::mt19937 gen(11);
+  std::uniform_real_distribution<double> dist(-1., 1.);
+  for (int i = 0; i < 50; ++i) points.push_back({dist(gen), dist(gen), dist(gen)});
+
+  Cech_complex cech_complex_from_points(points, 0.6);
+  const int DIMENSION = 4;
+  Simplex_tree st;
+  cech_complex_from_points.create_complex(st, DIMENSION);
+  Simplex_tree st_incremental;
+  cech_complex_from_points.create_complex_incremental(st_incremental, DIMENSION);
+  Simplex_tree st_parallel;
+  cech_complex_from_points.create_complex_incremental(st_parallel, DIMENSION, true);
+
+  std::clog << "st.num_simplices()=" << st.num_simplices() << std::endl;
+  BOOST_CHECK(st.dimension() == DIMENSION);
+  BOOST_CHECK(st_incremental.num_simplices() == st.num_simplices());
+  BOOST_CHECK(st_parallel.num_simplices() == st.num_simplices());
+  for (auto sh : st.complex_simplex_range()) {
+    std::vector<Simplex_tree::Vertex_handle> simplex;
+    for (auto vertex : st.simplex_vertex_range(sh)) simplex.push_back(vertex);
+    auto sh_incremental = st_incremental.find(simplex);
+    auto sh_parallel = st_parallel.find(simplex);
+    BOOST_REQUIRE(sh_incremental != st_incremental.null_simplex());
+    BOOST_REQUIRE(sh_parallel != st_parallel.null_simplex());
+    GUDHI_TEST_FLOAT_EQUALITY_CHECK(st_incremental.filtration(sh_incremental), st.filtration(sh), 1e-12);
+    GUDHI_TEST_FLOAT_EQUALITY_CHECK(st_parallel.filtration(sh_parallel), st.filtration(sh), 1e-12);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Cech_complex_incremental_blocks_at_max_radius) {
+  // Cospherical points of a grid, and random points
+  Point_cloud points;
+  for (double x : {-1., 0., 1.})
+    for (double y : {-1., 0., 1.})
+      for (double z : {-1., 0., 1.}) points.push_back({x, y, z});
+  std::mt19937 gen(5);
+  std::uniform_real_distribution<double> dist(-1., 1.);
+  for (int i = 0; i < 20; ++i) points.push_back({dist(gen), dist(gen), dist(gen)});
+
+  // The max_radius are the radii of simplices, so that the blocking decision depends on rounding errors.
+  const int DIMENSION = 3;
+  Simplex_tree st_all;
+  Cech_complex(points, 1.).create_complex(st_all, DIMENSION);
+  std::vector<Filtration_value> radii;
+  for (auto sh : st_all.complex_simplex_range())
+    if (st_all.dimension(sh) >= 2) radii.push_back(st_all.filtration(sh));
+  std::sort(radii.begin(), radii.end());
+  radii.erase(std::unique(radii.begin(), radii.end()), radii.end());
+  std::clog << radii.size() << " distinct radii" << std::endl;
+  for (std::size_t i = 0; i < radii.size(); i += 1 + radii.size() / 40) {
+    Cech_complex cech_complex_from_points(points, radii[i]);
+    Simplex_tree st;
+    cech_complex_from_points.create_complex(st, DIMENSION);
+    Simplex_tree st_incremental;
+    cech_complex_from_points.create_complex_incremental(st_incremental, DIMENSION);
+    BOOST_CHECK(st_incremental.num_simplices() == st.num_simplices());
+    for (auto sh : st.complex_simplex_range()) {
+      std::vector<Simplex_tree::Vertex_handle> simplex;
+      for (auto vertex : st.simplex_vertex_range(sh)) simplex.push_back(vertex);
+      BOOST_CHECK(st_incremental.find(simplex) != st_incremental.null_simplex());
+    }
+  }
+}
+
 #ifdef GUDHI_DEBUG
 BOOST_AUTO_TEST_CASE(Cech_create_complex_throw) {
   // ----------------------------------------------------------------------------
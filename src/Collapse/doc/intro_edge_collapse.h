@@ -74,6 +74,10 @@ namespace collapse {
  * After perfoming the reduction the filtration reduces to a flag-filtration with the same persistence as the original
  * filtration. 
  * 
+ * The domination of the edge \f$e_i\f$ in \f$G_i\f$ does not depend on the outcome of the previous steps. With TBB,
+ * these tests are performed in parallel for batches of consecutive edges, before the backward searches, which remain
+ * sequential. The output is the same as the one of the sequential algorithm.
+ * 
  * \subsection edgecollapseexample Basic edge collapse
  * 
  * This example calls `Gudhi::collapse::flag_complex_collapse_edges()` from a proximity graph represented as a list of
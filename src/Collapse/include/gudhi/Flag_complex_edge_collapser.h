@@ -13,8 +13,8 @@
 #define FLAG_COMPLEX_EDGE_COLLAPSER_H_
 
 #include <gudhi/Debug_utils.h>
+#include <gudhi/Instrumentation.h>
 
-#include <boost/functional/hash.hpp>
 #include <boost/iterator/iterator_facade.hpp>
 
 #include <Eigen/Sparse>
@@ -22,18 +22,19 @@
 
 #ifdef GUDHI_USE_TBB
 #include <tbb/parallel_sort.h>
+#include <tbb/parallel_for.h>
 #endif
 
 #include <iostream>
 #include <utility>  // for std::pair
 #include <vector>
 #include <unordered_map>
-#include <unordered_set>
-#include <set>
 #include <tuple>  // for std::tie
-#include <algorithm>  // for std::includes
-#include <iterator>  // for std::inserter
+#include <algorithm>  // for std::includes, std::push_heap, std::pop_heap
+#include <iterator>  // for std::back_inserter
 #include <type_traits>  // for std::decay
+#include <limits>  // for std::numeric_limits
+#include <stdexcept>  // for std::invalid_argument
 
 // Make compilation fail - required for external projects - https://github.com/GUDHI/gudhi-devel/issues/10
 #if !EIGEN_VERSION_AT_LEAST(3,1,0)
@@ -101,7 +102,7 @@ class Flag_complex_edge_collapser {
               else continue;
             }
             Edge_index e = it.value();
-            if(e <= ptr->ec->current_backward || ptr->ec->critical_edge_indicator_[e]) break;
+            if(e <= ptr->bound || ptr->ec->critical_edge_indicator_[e]) break;
           } while(++it, true);
         }
         bool equal(iterator const& other) const { return ptr == other.ptr; }
@@ -111,9 +112,11 @@ class Flag_complex_edge_collapser {
     mutable typename Sparse_vector::InnerIterator it;
     Flag_complex_edge_collapser const*ec;
     IVertex u;
+    Edge_index bound;
     iterator begin() const { return this; }
     iterator end() const { return {}; }
-    explicit Neighbours(Flag_complex_edge_collapser const*p,IVertex u):it(p->sparse_row_adjacency_matrix_[u]),ec(p),u(u){}
+    explicit Neighbours(Flag_complex_edge_collapser const*p,IVertex u,Edge_index bound)
+      :it(p->sparse_row_adjacency_matrix_[u]),ec(p),u(u),bound(bound){}
   };
 
   // A range of row indices
@@ -127,13 +130,6 @@ class Flag_complex_edge_collapser {
   // Map from row index to its vertex handle
   std::vector<Vertex_handle> row_to_vertex_;
 
-  // Index of the current edge in the backwards walk. Edges <= current_backward are part of the temporary graph,
-  // while edges > current_backward are removed unless critical_edge_indicator_.
-  Edge_index current_backward = -1;
-
-  // Map from IEdge to its index
-  std::unordered_map<IEdge, Edge_index, boost::hash<IEdge>> iedge_to_index_map_;
-
   // Boolean vector to indicate if the edge is critical.
   std::vector<bool> critical_edge_indicator_;
 
@@ -144,18 +140,31 @@ class Flag_complex_edge_collapser {
   // The matrix rows and columns are indexed by IVertex.
   Sparse_row_matrix sparse_row_adjacency_matrix_;
 
-  // The input, a vector of filtered edges.
+  // The input, a vector of filtered edges, when it is given as an unsorted range.
   std::vector<Filtered_edge> f_edge_vector_;
 
-  // Edge is the actual edge (u,v), with Vertex_handle u and v, not IVertex.
-  bool edge_is_dominated(Vertex_handle u, Vertex_handle v) const
+  // Map from edge index to the row indices of its extremities, in the order of the input.
+  std::vector<IEdge> edge_rows_;
+
+  // Filtration value of the last processed edge.
+  Filtration_value last_filtration_{};
+
+  // Max-heap of the edge indices to process in the backwards walk of set_edge_critical, and buffer for
+  // three_clique_indices, kept to reuse their memory.
+  std::vector<Edge_index> effected_indices_;
+  std::vector<Edge_index> clique_indices_;
+
+  // Whether the edge of index idx is dominated in the temporary graph: the edges <= idx, and the critical edges.
+  // Only reads the data structure, so that several edges can be tested concurrently.
+  bool edge_is_dominated(Edge_index idx) const
   {
-    const IVertex rw_u = vertex_to_row_.at(u);
-    const IVertex rw_v = vertex_to_row_.at(v);
+    const IVertex rw_u = edge_rows_[idx].first;
+    const IVertex rw_v = edge_rows_[idx].second;
 #ifdef DEBUG_TRACES
-    std::cout << "The edge {" << u << ", " << v <<  "} is going for domination check." << std::endl;
+    std::cout << "The edge {" << row_to_vertex_[rw_u] << ", " << row_to_vertex_[rw_v] <<
+      "} is going for domination check." << std::endl;
 #endif  // DEBUG_TRACES
-    auto common_neighbours = open_common_neighbours_row_index(rw_u, rw_v);
+    auto common_neighbours = open_common_neighbours_row_index(rw_u, rw_v, idx);
 #ifdef DEBUG_TRACES
     std::cout << "And its common neighbours are." << std::endl;
     for (auto neighbour : common_neighbours) {
@@ -167,7 +176,7 @@ class Flag_complex_edge_collapser {
       return true;
     else
       for (auto rw_c : common_neighbours) {
-        auto neighbours_c = neighbours_row_index<true>(rw_c);
+        auto neighbours_c = neighbours_row_index<true>(rw_c, idx);
         // If neighbours_c contains the common neighbours.
         if (std::includes(neighbours_c.begin(), neighbours_c.end(),
                           common_neighbours.begin(), common_neighbours.end()))
@@ -176,29 +185,23 @@ class Flag_complex_edge_collapser {
     return false;
   }
 
-  // Returns the edges connecting u and v (extremities of crit) to their common neighbors (not themselves)
-  std::set<Edge_index> three_clique_indices(Edge_index crit) {
-    std::set<Edge_index> edge_indices;
-
-    Vertex_handle u = std::get<0>(f_edge_vector_[crit]);
-    Vertex_handle v = std::get<1>(f_edge_vector_[crit]);
+  // Appends to edge_indices the edges connecting u and v (extremities of crit) to their common neighbors (not
+  // themselves) in the temporary graph of the edges <= crit and of the critical edges.
+  void three_clique_indices(Edge_index crit, std::vector<Edge_index>& edge_indices) const {
+    IVertex rw_u = edge_rows_[crit].first;
+    IVertex rw_v = edge_rows_[crit].second;
 
 #ifdef DEBUG_TRACES
-    std::cout << "The  current critical edge to re-check criticality with filt value is : f {" << u << "," << v
-              << "} = " << std::get<2>(f_edge_vector_[crit]) << std::endl;
+    std::cout << "The  current critical edge to re-check criticality is : {" << row_to_vertex_[rw_u] << ","
+              << row_to_vertex_[rw_v] << "}" << std::endl;
 #endif  // DEBUG_TRACES
-    auto rw_u = vertex_to_row_[u];
-    auto rw_v = vertex_to_row_[v];
-
-    IVertex_vector common_neighbours = open_common_neighbours_row_index(rw_u, rw_v);
+    IVertex_vector common_neighbours = open_common_neighbours_row_index(rw_u, rw_v, crit);
 
     for (auto rw_c : common_neighbours) {
-      IEdge e_with_new_nbhr_v = std::minmax(rw_u, rw_c);
-      IEdge e_with_new_nbhr_u = std::minmax(rw_v, rw_c);
-      edge_indices.emplace(iedge_to_index_map_[e_with_new_nbhr_v]);
-      edge_indices.emplace(iedge_to_index_map_[e_with_new_nbhr_u]);
+      // The adjacency matrix stores the edge indices
+      edge_indices.push_back(sparse_row_adjacency_matrix_[rw_u].coeff(rw_c));
+      edge_indices.push_back(sparse_row_adjacency_matrix_[rw_v].coeff(rw_c));
     }
-    return edge_indices;
   }
 
   // Detect and set all edges that are becoming critical
@@ -208,24 +211,37 @@ class Flag_complex_edge_collapser {
     std::cout << "The curent index  with filtration value " << indx << ", " << filt << " is primary critical" <<
     std::endl;
 #endif  // DEBUG_TRACES
-    std::set<Edge_index> effected_indices = three_clique_indices(indx);
-    // Cannot use boost::adaptors::reverse in such dynamic cases apparently
-    for (auto it = effected_indices.rbegin(); it != effected_indices.rend(); ++it) {
-      current_backward = *it;
-      Vertex_handle u = std::get<0>(f_edge_vector_[current_backward]);
-      Vertex_handle v = std::get<1>(f_edge_vector_[current_backward]);
+    // The effected edges are processed by decreasing index, and the edges added during the walk have a smaller index
+    // than the current one, so a max-heap (with duplicates) replaces an ordered set.
+    effected_indices_.clear();
+    three_clique_indices(indx, effected_indices_);
+    std::make_heap(effected_indices_.begin(), effected_indices_.end());
+    Edge_index current_backward = indx;
+    while (!effected_indices_.empty()) {
+      std::pop_heap(effected_indices_.begin(), effected_indices_.end());
+      Edge_index effected_index = effected_indices_.back();
+      effected_indices_.pop_back();
+      if (effected_index == current_backward) continue;  // duplicate
+      // Edges <= current_backward are part of the temporary graph, while edges > current_backward are removed unless
+      // critical_edge_indicator_.
+      current_backward = effected_index;
+      Vertex_handle u = row_to_vertex_[edge_rows_[current_backward].first];
+      Vertex_handle v = row_to_vertex_[edge_rows_[current_backward].second];
       // If current_backward is not critical so it should be processed, otherwise it stays in the graph
       if (!critical_edge_indicator_[current_backward]) {
-        if (!edge_is_dominated(u, v)) {
+        if (!edge_is_dominated(current_backward)) {
 #ifdef DEBUG_TRACES
           std::cout << "The curent index became critical " << current_backward  << std::endl;
 #endif  // DEBUG_TRACES
           critical_edge_indicator_[current_backward] = true;
           filtered_edge_output(u, v, filt);
-          std::set<Edge_index> inner_effected_indcs = three_clique_indices(current_backward);
-          for (auto inr_idx : inner_effected_indcs) {
-            if(inr_idx < current_backward) // && !critical_edge_indicator_[inr_idx]
-              effected_indices.emplace(inr_idx);
+          clique_indices_.clear();
+          three_clique_indices(current_backward, clique_indices_);
+          for (auto inr_idx : clique_indices_) {
+            if (inr_idx < current_backward) {  // && !critical_edge_indicator_[inr_idx]
+              effected_indices_.push_back(inr_idx);
+              std::push_heap(effected_indices_.begin(), effected_indices_.end());
+            }
           }
 #ifdef DEBUG_TRACES
           std::cout << "The following edge is critical with filt value: {" << u << "," << v << "}; "
@@ -234,22 +250,22 @@ class Flag_complex_edge_collapser {
         }
       }
     }
-    // Clear the implicit "removed from graph" data structure
-    current_backward = -1;
   }
 
-  // Returns list of neighbors of a particular vertex.
+  // Returns list of neighbors of a particular vertex, in the temporary graph of the edges <= bound and of the
+  // critical edges.
   template<bool closed>
-  auto neighbours_row_index(IVertex rw_u) const
+  auto neighbours_row_index(IVertex rw_u, Edge_index bound) const
   {
-    return Neighbours<closed>(this, rw_u);
+    return Neighbours<closed>(this, rw_u, bound);
   }
 
-  // Returns the list of open neighbours of the edge :{u,v}.
-  IVertex_vector open_common_neighbours_row_index(IVertex rw_u, IVertex rw_v) const
+  // Returns the list of open neighbours of the edge :{u,v}, in the temporary graph of the edges <= bound and of the
+  // critical edges.
+  IVertex_vector open_common_neighbours_row_index(IVertex rw_u, IVertex rw_v, Edge_index bound) const
   {
-    auto non_zero_indices_u = neighbours_row_index<false>(rw_u);
-    auto non_zero_indices_v = neighbours_row_index<false>(rw_v);
+    auto non_zero_indices_u = neighbours_row_index<false>(rw_u, bound);
+    auto non_zero_indices_v = neighbours_row_index<false>(rw_v, bound);
     IVertex_vector common;
     std::set_intersection(non_zero_indices_u.begin(), non_zero_indices_u.end(), non_zero_indices_v.begin(),
                           non_zero_indices_v.end(), std::back_inserter(common));
@@ -273,7 +289,7 @@ class Flag_complex_edge_collapser {
     return result.first->second;
   }
 
-  // Insert an edge in the data structure
+  // Insert an edge in the data structure, returns the row indices of u and v
   // @exception std::invalid_argument In debug mode, if u == v
   IEdge insert_new_edge(Vertex_handle u, Vertex_handle v, Edge_index idx)
   {
@@ -286,10 +302,44 @@ class Flag_complex_edge_collapser {
 #endif  // DEBUG_TRACES
     sparse_row_adjacency_matrix_[rw_u].insert(rw_v) = idx;
     sparse_row_adjacency_matrix_[rw_v].insert(rw_u) = idx;
-    return std::minmax(rw_u, rw_v);
+    return IEdge(rw_u, rw_v);
+  }
+
+  // Inserts the next edge of the filtration in the graph and returns its index
+  // @exception std::invalid_argument In debug mode, if u == v or if the edges are not sorted by filtration value
+  Edge_index insert_next_edge(Vertex_handle u, Vertex_handle v, Filtration_value filtration) {
+    GUDHI_CHECK(edge_rows_.empty() || !(filtration < last_filtration_),
+                std::invalid_argument("Flag_complex_edge_collapser::process_edge - edges must be given in "
+                                      "non-decreasing order of filtration value"));
+    last_filtration_ = filtration;
+    Edge_index idx = edge_rows_.size();
+
+    // Inserts the edge in the sparse matrix to update the graph (G_i)
+    edge_rows_.push_back(insert_new_edge(u, v, idx));
+    critical_edge_indicator_.push_back(false);
+    return idx;
+  }
+
+  // Outputs the edge of index idx if it is not dominated in G_idx, and the edges that become critical with it
+  template<typename FilteredEdgeOutput>
+  void collapse_next_edge(Edge_index idx, bool dominated, Filtration_value filtration,
+                          FilteredEdgeOutput& filtered_edge_output) {
+    if (!dominated) {
+      critical_edge_indicator_[idx] = true;
+      filtered_edge_output(row_to_vertex_[edge_rows_[idx].first], row_to_vertex_[edge_rows_[idx].second], filtration);
+      if (idx > 1)
+        set_edge_critical(idx, filtration, filtered_edge_output);
+    } else {
+      GUDHI_INSTRUMENT_COUNT("Flag_complex_edge_collapser::dominated_edges", 1);
+    }
   }
 
  public:
+  /** \brief Flag_complex_edge_collapser constructor for edges that are given one by one, in non-decreasing order of
+   * filtration value, to `Flag_complex_edge_collapser::process_edge`.
+   */
+  Flag_complex_edge_collapser() { }
+
   /** \brief Flag_complex_edge_collapser constructor from a range of filtered edges.
    *
    * @param[in] edges Range of Filtered edges range.There is no need the range to be sorted, as it will be performed in
@@ -310,6 +360,7 @@ class Flag_complex_edge_collapser {
    */
   template<typename FilteredEdgeOutput>
   void process_edges(FilteredEdgeOutput filtered_edge_output) {
+    GUDHI_INSTRUMENT_SCOPE("Flag_complex_edge_collapser::process_edges");
     // Sort edges
     auto sort_by_filtration = [](const Filtered_edge& edge_a, const Filtered_edge& edge_b) -> bool
     {
@@ -322,25 +373,73 @@ class Flag_complex_edge_collapser {
     std::sort(f_edge_vector_.begin(), f_edge_vector_.end(), sort_by_filtration);
 #endif
 
-    for (Edge_index endIdx = 0; endIdx < f_edge_vector_.size(); endIdx++) {
-      Filtered_edge fec = f_edge_vector_[endIdx];
-      Vertex_handle u = std::get<0>(fec);
-      Vertex_handle v = std::get<1>(fec);
-      Filtration_value filt = std::get<2>(fec);
-
-      // Inserts the edge in the sparse matrix to update the graph (G_i)
-      IEdge ie = insert_new_edge(u, v, endIdx);
+    process_sorted_edges(f_edge_vector_.begin(), f_edge_vector_.end(), filtered_edge_output);
+    // The edges are now stored in the graph
+    f_edge_vector_ = std::vector<Filtered_edge>();
+  }
 
-      iedge_to_index_map_.emplace(ie, endIdx);
-      critical_edge_indicator_.push_back(false);
+  /** \brief Inserts the next edge of the filtration and performs the edge collapse that it triggers.
+   *
+   * @param[in] u, v Extremities of the edge, that must not have been processed before.
+   * @param[in] filtration Filtration value of the edge, not smaller than the one of the previously processed edges.
+   * @param[in] filtered_edge_output is a functor that is called on the output edges, in non-decreasing order of
+   * filtration, as filtered_edge_output(u, v, f) where u and v are Vertex_handle representing the extremities of the
+   * edge, and f is its new Filtration_value.
+   * @exception std::invalid_argument In debug mode, if u == v or if filtration is smaller than the filtration value
+   * of the previous edge.
+   */
+  template<typename FilteredEdgeOutput>
+  void process_edge(Vertex_handle u, Vertex_handle v, Filtration_value filtration,
+                    FilteredEdgeOutput filtered_edge_output) {
+    Edge_index idx = insert_next_edge(u, v, filtration);
+    collapse_next_edge(idx, edge_is_dominated(idx), filtration, filtered_edge_output);
+  }
 
-      if (!edge_is_dominated(u, v)) {
-        critical_edge_indicator_[endIdx] = true;
-        filtered_edge_output(u, v, filt);
-        if (endIdx > 1)
-          set_edge_critical(endIdx, filt, filtered_edge_output);
+  /** \brief Performs edge collapse on a range of edges, that are the next edges of the filtration.
+   *
+   * The output is the same as with `Flag_complex_edge_collapser::process_edge` called on each edge. With TBB, the
+   * edges are inserted by batches, and the domination of the edges of a batch in the graph of the edges before them
+   * is tested in parallel.
+   *
+   * @param[in] first, last Range of filtered edges, sorted by non-decreasing filtration value.
+   * @param[in] filtered_edge_output is a functor that is called on the output edges, in non-decreasing order of
+   * filtration, as filtered_edge_output(u, v, f) where u and v are Vertex_handle representing the extremities of the
+   * edge, and f is its new Filtration_value.
+   * @exception std::invalid_argument In debug mode, if the edges are not sorted by non-decreasing filtration value.
+   *
+   * \tparam FilteredEdgeInputIterator is an input iterator on a `Flag_complex_edge_collapser::Filtered_edge`.
+   */
+  template<typename FilteredEdgeInputIterator, typename FilteredEdgeOutput>
+  void process_sorted_edges(FilteredEdgeInputIterator first, FilteredEdgeInputIterator last,
+                            FilteredEdgeOutput filtered_edge_output) {
+#ifdef GUDHI_USE_TBB
+    // The domination of an edge in G_i does not depend on the edges after it, nor on which edges are critical, so the
+    // tests of a batch are independent. The edges that become critical are then found sequentially, in the graph
+    // restricted to G_i.
+    const std::size_t batch_size = 1024;
+    std::vector<Filtration_value> filtrations;
+    std::vector<char> dominated;
+    while (first != last) {
+      Edge_index batch_begin = edge_rows_.size();
+      filtrations.clear();
+      for (; first != last && filtrations.size() < batch_size; ++first) {
+        auto&& edge = *first;
+        insert_next_edge(std::get<0>(edge), std::get<1>(edge), std::get<2>(edge));
+        filtrations.push_back(std::get<2>(edge));
       }
+      dominated.resize(filtrations.size());
+      tbb::parallel_for(std::size_t(0), filtrations.size(), [&](std::size_t i) {
+        dominated[i] = edge_is_dominated(batch_begin + i);
+      });
+      for (std::size_t i = 0; i < filtrations.size(); ++i)
+        collapse_next_edge(batch_begin + i, dominated[i], filtrations[i], filtered_edge_output);
+    }
+#else
+    for (; first != last; ++first) {
+      auto&& edge = *first;
+      process_edge(std::get<0>(edge), std::get<1>(edge), std::get<2>(edge), filtered_edge_output);
     }
+#endif
   }
 
 };
@@ -24,6 +24,8 @@
 #include <vector>
 #include <array>
 #include <cmath>
+#include <cstdlib>  // for std::rand
+#include <algorithm>  // for std::stable_sort
 
 struct Simplicial_complex {
   using Vertex_handle = short;
@@ -196,3 +198,43 @@ BOOST_AUTO_TEST_CASE(collapse_from_proximity_graph) {
   BOOST_CHECK(filtration_is_edge_length_nb == 4);
   BOOST_CHECK(filtration_is_diagonal_length_nb == 1);
 }
+
+BOOST_AUTO_TEST_CASE(collapse_edge_by_edge) {
+  std::cout << "***** COLLAPSE EDGE BY EDGE *****" << std::endl;
+  std::srand(42);
+  std::vector<std::vector<Filtration_value>> point_cloud;
+  for (int i = 0; i < 100; i++)
+    point_cloud.push_back({static_cast<Filtration_value>(std::rand()) / RAND_MAX,
+                           static_cast<Filtration_value>(std::rand()) / RAND_MAX});
+  Filtered_edge_list edges;
+  for (std::size_t i = 0; i < point_cloud.size(); i++)
+    for (std::size_t j = i + 1; j < point_cloud.size(); j++)
+      edges.emplace_back(i, j, Gudhi::Euclidean_distance()(point_cloud[i], point_cloud[j]));
+  std::stable_sort(edges.begin(), edges.end(), [](const Filtered_edge& edge_a, const Filtered_edge& edge_b) {
+    return std::get<2>(edge_a) < std::get<2>(edge_b);
+  });
+
+  auto remaining_edges = Gudhi::collapse::flag_complex_collapse_edges(edges);
+  std::cout << edges.size() << " edges collapsed to " << remaining_edges.size() << " edges" << std::endl;
+  BOOST_CHECK(remaining_edges.size() < edges.size());
+
+  // Edges processed one by one, without the batches of process_sorted_edges
+  Filtered_edge_list serial_edges;
+  Gudhi::collapse::Flag_complex_edge_collapser<Vertex_handle, Filtration_value> edge_collapser;
+  for (auto edge : edges)
+    edge_collapser.process_edge(std::get<0>(edge), std::get<1>(edge), std::get<2>(edge),
+                                [&serial_edges](Vertex_handle u, Vertex_handle v, Filtration_value filtration) {
+                                  // The output is in non-decreasing order of filtration
+                                  BOOST_CHECK(serial_edges.empty() || std::get<2>(serial_edges.back()) <= filtration);
+                                  serial_edges.emplace_back(u, v, filtration);
+                                });
+  BOOST_CHECK(serial_edges == remaining_edges);
+
+#ifdef GUDHI_DEBUG
+  std::swap(edges.front(), edges.back());
+  Gudhi::collapse::Flag_complex_edge_collapser<Vertex_handle, Filtration_value> unsorted_edge_collapser;
+  BOOST_CHECK_THROW(unsorted_edge_collapser.process_sorted_edges(edges.begin(), edges.end(),
+                                                                 [](Vertex_handle, Vertex_handle, Filtration_value) {}),
+                    std::invalid_argument);
+#endif
+}
@@ -127,6 +127,28 @@ namespace persistent_cohomology {
  by increasing filtration values (breaking ties so as a simplex appears after
  its subsimplices of same filtration value) provides an indexing scheme.
 
+ \section pcohreduction Matrix Reduction
+ The reduction used by Gudhi::persistent_cohomology::Persistent_cohomology is selected by its third template
+ parameter. Gudhi::persistent_cohomology::Annotation_matrix_reduction (default) maintains the Compressed Annotation
+ Matrix, and supports multi-field persistent homology.
+ Gudhi::persistent_cohomology::Compressed_column_reduction reduces the coboundary matrix of a `Simplex_tree` with the
+clearing optimization, enumerates the coboundary of a simplex from the simplex tree when its column is reduced, and
+only stores the columns modified by the reduction, in contiguous arrays. It only supports coefficient fields with a
+single characteristic. Both reductions give the same persistent pairs, in the same order, and use about the same
+memory on Rips complexes, where the compressed column reduction is about 20% faster.
+Gudhi::persistent_cohomology::Chunk_reduction splits the boundary matrix into chunks of consecutive columns, which
+ are reduced independently, in parallel when TBB is available, and then reduces together the few columns whose pivot
+ is in another chunk \cite DBLP:conf/alenex/BauerKR14. It gives the same intervals, and is well suited to lower star
+ filtrations of large images, where most pairs are local. The reduction can also be chosen for a single computation,
+ with the overload of `compute_persistent_cohomology` which takes its tag.
+
+ \section pcohzerodimensional Zero-dimensional persistence
+ When only the intervals of dimension 0 are needed, e.g. for clustering,
+ Gudhi::persistent_cohomology::Zero_dimensional_persistence computes them from the vertices and edges only, given as a filtered graph, the points of a Rips complex with a
+ threshold, or a filtered complex such as a `Simplex_tree` or a `Bitmap_cubical_complex`. The edges are sorted with a
+ radix sort and the connected components are maintained in a flat union-find, without building a `Simplex_tree` nor
+ sorting its whole filtration.
+
 \section pcohexamples Examples
 
 We provide several example files: run these examples with -h for details on their use, and read the README file.
@@ -13,12 +13,20 @@
 
 #include <gudhi/Persistent_cohomology/Persistent_cohomology_column.h>
 #include <gudhi/Persistent_cohomology/Field_Zp.h>
+#include <gudhi/Persistent_cohomology/Compressed_column_matrix.h>
+#include <gudhi/Persistent_cohomology/Cofacet_enumerator.h>
+#include <gudhi/Persistent_cohomology/reduction_tag.h>
 #include <gudhi/Simple_object_pool.h>
+#include <gudhi/Instrumentation.h>
 
 #include <boost/intrusive/set.hpp>
 #include <boost/pending/disjoint_sets.hpp>
 #include <boost/intrusive/list.hpp>
 
+#ifdef GUDHI_USE_TBB
+#include <tbb/parallel_for.h>
+#endif
+
 #include <map>
 #include <utility>
 #include <list>
@@ -30,11 +38,16 @@
 #include <algorithm>
 #include <string>
 #include <stdexcept>  // for std::out_of_range
+#include <cmath>  // for std::sqrt
+#include <type_traits>  // for std::is_same
 
 namespace Gudhi {
 
 namespace persistent_cohomology {
 
+// Only needed to reject Multi_field in the reductions that do not support it.
+class Multi_field;
+
 /** \brief Computes the persistent cohomology of a filtered complex.
  *
  * \ingroup persistent_cohomology
@@ -44,11 +57,15 @@ namespace persistent_cohomology {
  * and is adapted to the computation of Multi-Field Persistent Homology (MF)
  * \cite boissonnat:hal-00922572 .
  *
+ * The reduction is selected by MatrixReduction, either Annotation_matrix_reduction (default),
+ * Compressed_column_reduction or Chunk_reduction.
+ *
  * \implements PersistentHomology
  *
  */
 // TODO(CM): Memory allocation policy: classic, use a mempool, etc.
-template<class FilteredComplex, class CoefficientField>
+template<class FilteredComplex, class CoefficientField,
+         class MatrixReduction = Annotation_matrix_reduction>
 class Persistent_cohomology {
  public:
   // Data attached to each simplex to interface with a Property Map.
@@ -80,6 +97,9 @@ class Persistent_cohomology {
       boost::intrusive::constant_time_size<false> > Cam;
   // Sparse column type for the annotation of the boundary of an element.
   typedef std::vector<std::pair<Simplex_key, Arith_element> > A_ds_type;
+  // Storage of the reduced columns for the Compressed_column_reduction.
+  typedef Compressed_column_matrix<Simplex_key, Arith_element> Reduced_matrix;
+  typedef typename Reduced_matrix::Column Reduced_column;
 
  public:
   /** \brief Initializes the Persistent_cohomology class.
@@ -99,7 +119,7 @@ class Persistent_cohomology {
         num_simplices_(cpx_->num_simplices()),           // num_simplices save to avoid to call thrice the function
         ds_rank_(num_simplices_),                        // union-find
         ds_parent_(num_simplices_),                      // union-find
-        ds_repr_(num_simplices_, NULL),                  // union-find -> annotation vectors
+        ds_repr_(),                                      // union-find -> annotation vectors
         dsets_(&ds_rank_[0], &ds_parent_[0]),            // union-find
         cam_(),                                          // collection of annotation vectors
         zero_cocycles_(),                                // union-find -> Simplex_key of creator for 0-homology
@@ -170,7 +190,30 @@ class Persistent_cohomology {
    * Assumes that the filtration provided by the simplicial complex is
    * valid. Undefined behavior otherwise. */
   void compute_persistent_cohomology(Filtration_value min_interval_length = 0) {
+    GUDHI_INSTRUMENT_SCOPE("Persistent_cohomology::compute_persistent_cohomology");
+    interval_length_policy.set_length(min_interval_length);
+    compute_persistent_intervals(MatrixReduction());
+  }
+
+  /** \brief Compute the persistent homology of the filtered complex with the given reduction, e.g.
+   * Chunk_reduction, instead of the one selected by MatrixReduction.
+   *
+   * @param[in] min_interval_length the computation discards all intervals of length
+   *                                less or equal than min_interval_length
+   * @param[in] reduction           tag of the reduction
+   */
+  template<class Reduction>
+  void compute_persistent_cohomology(Filtration_value min_interval_length, Reduction reduction) {
+    GUDHI_INSTRUMENT_SCOPE("Persistent_cohomology::compute_persistent_cohomology");
     interval_length_policy.set_length(min_interval_length);
+    compute_persistent_intervals(reduction);
+  }
+
+ private:
+  /** \brief Computes the persistent intervals with the Compressed Annotation Matrix. */
+  void compute_persistent_intervals(Annotation_matrix_reduction) {
+    // The annotation vectors of the union-find are only used by the Compressed Annotation Matrix.
+    ds_repr_.assign(num_simplices_, NULL);
     // Compute all finite intervals
     for (auto sh : cpx_->filtration_simplex_range()) {
       int dim_simplex = cpx_->dimension(sh);
@@ -186,6 +229,409 @@ class Persistent_cohomology {
       }
     }
     // Compute infinite intervals of dimension 0
+    compute_infinite_intervals_in_dimension_zero();
+    // Compute infinite interval of dimension > 0
+    for (auto cocycle : transverse_idx_) {
+      persistent_pairs_.emplace_back(
+          cpx_->simplex(cocycle.first), cpx_->null_simplex(), cocycle.second.characteristics_);
+    }
+  }
+
+  /** \brief Computes the persistent intervals with the compressed column reduction.
+   *
+   * The 0-dimensional persistence is computed with the union-find data structure, then the coboundary matrix is
+   * reduced dimension by dimension, from dimension 1 upwards, with the columns in reverse filtration order.
+   * A simplex which is the pivot of a reduced column of the dimension below is known to have a zero column after
+   * reduction, and its column is skipped (clearing). The coboundaries are computed on the fly from the simplex tree.
+   * When the pivot of a coboundary is not the pivot of another column, the column is already reduced, and the
+   * enumeration of the coboundary stops at the pivot. Otherwise, the column being reduced is a heap of the entries of
+   * the coboundaries added to it, in which the additions are only resolved when the pivot is extracted. A reduced
+   * column is stored as the combination of coboundaries it is, without the coboundary of its own simplex, which is
+   * empty for most of them, and not as its entries. */
+  void compute_persistent_intervals(Compressed_column_reduction) {
+    static_assert(!std::is_same<CoefficientField, Multi_field>::value,
+                  "Compressed_column_reduction only supports coefficient fields with a single characteristic");
+    auto const& filtration = cpx_->filtration_simplex_range();
+    const int dim_top = cpx_->dimension();
+
+    // pivot_column[k] is the position in reduced_matrix of the reduced column whose pivot is the simplex of key k,
+    // no_column if there is none. Positions are only meaningful for the dimension being reduced, afterwards they
+    // just mark the simplices whose column is cleared.
+    const Simplex_key no_column = std::numeric_limits<Simplex_key>::max();
+    std::vector<Simplex_key> pivot_column(num_simplices_, no_column);
+
+    // 0-dimensional persistence. The columns of the edges which merge two connected components are cleared.
+    if (dim_top >= 1) {
+      for (auto sh : filtration) {
+        if (cpx_->dimension(sh) == 1 && update_connected_components(sh)) pivot_column[cpx_->key(sh)] = 0;
+      }
+    }
+    // The finite intervals of dimension 0 are already sorted by death.
+    std::size_t num_zero_intervals = persistent_pairs_.size();
+
+    std::vector<std::pair<Simplex_key, Simplex_key>> finite_intervals;  // (birth key, death key)
+    std::vector<Simplex_key> infinite_intervals;  // birth key
+    Cofacet_enumerator<FilteredComplex> cofacets(*cpx_);
+    // The coefficient of a simplex in the boundary of a cofacet is (-1)^i, where i is the position of the vertex
+    // of the cofacet which is not in the simplex.
+    Arith_element coefficient[2] = {coeff_field_.times(coeff_field_.multiplicative_identity(), 1),
+                                    coeff_field_.times(coeff_field_.multiplicative_identity(), -1)};
+    // The column being reduced, a heap of (key, coefficient) with the smallest key on top, where a key may appear
+    // several times, and the combination of coboundaries added to it.
+    typedef std::pair<Simplex_key, Arith_element> Entry;
+    auto key_greater = [](const Entry& a, const Entry& b) { return a.first > b.first; };
+    std::vector<Entry> col;
+    Reduced_column combination;
+    auto add_coboundary = [&](Simplex_key key, Arith_element w) {
+      cofacets.for_each_cofacet(cpx_->simplex(key), [&](Simplex_handle tau, std::size_t position) {
+        col.emplace_back(cpx_->key(tau), coeff_field_.times(coefficient[position % 2], w));
+        std::push_heap(col.begin(), col.end(), key_greater);
+        return true;
+      });
+    };
+    // Sums the entries with the smallest key, until it is not zero, and leaves it on top. Returns false if the
+    // column is zero.
+    auto resolve_pivot = [&]() {
+      while (!col.empty()) {
+        std::pop_heap(col.begin(), col.end(), key_greater);
+        Entry pivot = col.back();
+        col.pop_back();
+        while (!col.empty() && col.front().first == pivot.first) {
+          pivot.second = coeff_field_.plus_equal(pivot.second, col.front().second);
+          std::pop_heap(col.begin(), col.end(), key_greater);
+          col.pop_back();
+        }
+        if (pivot.second != coeff_field_.additive_identity()) {
+          col.push_back(pivot);
+          std::push_heap(col.begin(), col.end(), key_greater);
+          return true;
+        }
+      }
+      return false;
+    };
+    // The reduced columns of the current dimension as combinations of coboundaries, their simplices and the
+    // coefficients of their pivots.
+    Reduced_matrix reduced_matrix;
+    std::vector<Simplex_key> reduced_keys;
+    std::vector<Arith_element> pivot_coefficients;
+    for (int dim = 1; dim <= dim_top && (dim < dim_top || dim < dim_max_); ++dim) {
+      reduced_matrix.clear();
+      reduced_keys.clear();
+      pivot_coefficients.clear();
+      for (auto sh_it = std::end(filtration); sh_it != std::begin(filtration);) {
+        Simplex_handle sh = *--sh_it;
+        if (cpx_->dimension(sh) != dim) continue;
+        Simplex_key key = cpx_->key(sh);
+        if (pivot_column[key] != no_column) continue;  // clearing
+        col.clear();
+        combination.clear();
+        if (dim < dim_top) {
+          // The pivot of a column is the cofacet with the smallest key. Most columns are reduced as they are, when
+          // their pivot is not the pivot of another column, and the heap is only built for the others.
+          // The cofacets with the same filtration value are ordered by increasing new vertex, hence a cofacet with
+          // the filtration value of the simplex is the first one with this filtration value: the pivot.
+          Entry pivot(no_column, coeff_field_.additive_identity());
+          Filtration_value filtration_sh = cpx_->filtration(sh);
+          cofacets.for_each_cofacet(sh, [&](Simplex_handle tau, std::size_t position) {
+            Simplex_key tau_key = cpx_->key(tau);
+            if (tau_key < pivot.first) pivot = Entry(tau_key, coefficient[position % 2]);
+            return cpx_->filtration(tau) != filtration_sh;
+          });
+          if (pivot.first != no_column && pivot_column[pivot.first] == no_column) {
+            col.push_back(pivot);
+          } else {
+            add_coboundary(key, coeff_field_.multiplicative_identity());
+          }
+        }
+        // Reduce the column.
+        while (resolve_pivot() && pivot_column[col.front().first] != no_column) {
+          std::size_t other = pivot_column[col.front().first];
+          Arith_element inv_x = coeff_field_.inverse(pivot_coefficients[other], coeff_field_.characteristic()).first;
+          Arith_element w = coeff_field_.times_minus(inv_x, col.front().second);
+          GUDHI_INSTRUMENT_COUNT("Persistent_cohomology::column_additions", 1);
+          add_coboundary(reduced_keys[other], w);
+          combination.emplace_back(reduced_keys[other], w);
+          for (auto it = reduced_matrix.begin(other); it != reduced_matrix.end(other); ++it) {
+            Arith_element x = coeff_field_.times(it->second, w);
+            add_coboundary(it->first, x);
+            combination.emplace_back(it->first, x);
+          }
+        }
+        if (col.empty()) {
+          if (dim < dim_max_) infinite_intervals.push_back(key);
+        } else {
+          compress_combination(combination);
+          pivot_column[col.front().first] = reduced_matrix.push_back(combination);
+          reduced_keys.push_back(key);
+          pivot_coefficients.push_back(col.front().second);
+          finite_intervals.emplace_back(key, col.front().first);
+        }
+      }
+    }
+
+    // Output the intervals in the same order as with the annotation matrix: finite intervals by increasing death,
+    // then infinite intervals of dimension 0, then infinite intervals of higher dimension by increasing birth.
+    std::sort(finite_intervals.begin(), finite_intervals.end(),
+              [](const std::pair<Simplex_key, Simplex_key>& a, const std::pair<Simplex_key, Simplex_key>& b) {
+                return a.second < b.second;
+              });
+    for (auto& interval : finite_intervals) {
+      Simplex_handle birth = cpx_->simplex(interval.first);
+      Simplex_handle death = cpx_->simplex(interval.second);
+      if (interval_length_policy(birth, death)) {
+        persistent_pairs_.emplace_back(birth, death, coeff_field_.characteristic());
+      }
+    }
+    std::inplace_merge(persistent_pairs_.begin(), persistent_pairs_.begin() + num_zero_intervals,
+                       persistent_pairs_.end(),
+                       [this](const Persistent_interval& a, const Persistent_interval& b) {
+                         return cpx_->key(get<1>(a)) < cpx_->key(get<1>(b));
+                       });
+    compute_infinite_intervals_in_dimension_zero();
+    std::sort(infinite_intervals.begin(), infinite_intervals.end());
+    for (Simplex_key key : infinite_intervals) {
+      persistent_pairs_.emplace_back(cpx_->simplex(key), cpx_->null_simplex(), coeff_field_.characteristic());
+    }
+  }
+
+  /** \brief Computes the persistent intervals with the chunk reduction.
+   *
+   * The boundary matrix, with columns sorted by decreasing row key so that the pivot is the first entry, is split
+   * into chunks of about sqrt(n) consecutive columns. In a chunk, columns are reduced from the highest dimension
+   * down, only with the columns of the chunk and as long as their pivot lies in the chunk. Such a pivot is final,
+   * since the columns of the previous chunks have smaller pivots. The other columns are global: their rows which
+   * are paired as a death are removed, which does not change the pairing, and their rows paired as a birth are
+   * eliminated with the column of the death. The compressed global columns are then reduced sequentially, dimension
+   * by dimension from the highest one, with clearing. */
+  void compute_persistent_intervals(Chunk_reduction) {
+    static_assert(!std::is_same<CoefficientField, Multi_field>::value,
+                  "Chunk_reduction only supports coefficient fields with a single characteristic");
+    const Simplex_key no_key = std::numeric_limits<Simplex_key>::max();
+    const std::size_t chunk_size = std::max<std::size_t>(1, std::sqrt(static_cast<double>(num_simplices_)));
+    const std::size_t num_chunks = (num_simplices_ + chunk_size - 1) / chunk_size;
+
+    // partner[k] is the key of the simplex paired with the simplex of key k, no_key if it is not known yet.
+    std::vector<Simplex_key> partner(num_simplices_, no_key);
+    // Non zero reduced columns, stored by chunk. column_position[k] is the position of the column of key k in the
+    // storage of its chunk.
+    std::vector<Reduced_matrix> chunk_columns(num_chunks);
+    std::vector<std::size_t> column_position(num_simplices_);
+    std::vector<std::vector<Simplex_key>> global_keys_by_chunk(num_chunks);
+
+    auto reduce_chunk = [&](std::size_t chunk) {
+      Simplex_key first = chunk * chunk_size;
+      Simplex_key last = std::min(first + chunk_size, num_simplices_);
+      std::vector<std::vector<Simplex_key>> keys_by_dimension;
+      for (Simplex_key key = first; key < last; ++key) {
+        std::size_t dim_simplex = cpx_->dimension(cpx_->simplex(key));
+        if (keys_by_dimension.size() <= dim_simplex) keys_by_dimension.resize(dim_simplex + 1);
+        keys_by_dimension[dim_simplex].push_back(key);
+      }
+      Reduced_matrix& columns = chunk_columns[chunk];
+      Reduced_column col, col_tmp;
+      for (std::size_t dim = keys_by_dimension.size(); dim-- > 0;) {
+        for (Simplex_key key : keys_by_dimension[dim]) {
+          if (partner[key] != no_key) continue;  // clearing, the simplex is the pivot of a column of the chunk
+          boundary_column(col, key);
+          while (!col.empty() && col.front().first >= first && partner[col.front().first] != no_key) {
+            std::size_t other = column_position[partner[col.front().first]];
+            Arith_element inv_x = coeff_field_.inverse(columns.begin(other)->second,
+                                                       coeff_field_.characteristic()).first;
+            Arith_element w = coeff_field_.times_minus(inv_x, col.front().second);
+            plus_equal_column(col_tmp, col, columns.begin(other), columns.end(other), w);
+            col.swap(col_tmp);
+          }
+          if (col.empty()) continue;
+          column_position[key] = columns.push_back(col);
+          if (col.front().first >= first) {
+            partner[col.front().first] = key;
+            partner[key] = col.front().first;
+          } else {
+            global_keys_by_chunk[chunk].push_back(key);
+          }
+        }
+      }
+    };
+#ifdef GUDHI_USE_TBB
+    tbb::parallel_for(std::size_t(0), num_chunks, reduce_chunk);
+#else
+    for (std::size_t chunk = 0; chunk < num_chunks; ++chunk) reduce_chunk(chunk);
+#endif
+
+    // The global columns are compressed and reduced from the highest dimension down, so that the columns of the
+    // simplices paired as a birth in the dimension above are cleared before being compressed.
+    std::vector<std::vector<Simplex_key>> global_keys_by_dimension;
+    for (auto& keys : global_keys_by_chunk) {
+      for (Simplex_key key : keys) {
+        std::size_t dim_simplex = cpx_->dimension(cpx_->simplex(key));
+        if (global_keys_by_dimension.size() <= dim_simplex) global_keys_by_dimension.resize(dim_simplex + 1);
+        global_keys_by_dimension[dim_simplex].push_back(key);
+      }
+    }
+    std::vector<Simplex_key> global_keys;
+    std::vector<Reduced_column> global_columns;
+    // Removes from the column of key its rows paired in a chunk. The rows of a column of dimension dim are only
+    // paired by the chunks or by the global columns of dimension dim, which are not reduced yet.
+    auto compress_column = [&](std::size_t idx) {
+      Simplex_key key = global_keys[idx];
+      const Reduced_matrix& columns = chunk_columns[key / chunk_size];
+      Reduced_column col(columns.begin(column_position[key]), columns.end(column_position[key])), col_tmp;
+      Reduced_column& compressed = global_columns[idx];
+      compressed.clear();
+      std::size_t i = 0;
+      while (i < col.size()) {
+        Simplex_key row = col[i].first;
+        if (partner[row] == no_key) {
+          compressed.push_back(col[i++]);
+        } else if (partner[row] < row) {
+          ++i;  // the row is paired as a death
+        } else {
+          // The row is paired as a birth, with a column of its chunk, which is before the chunk of key.
+          const Reduced_matrix& other_columns = chunk_columns[row / chunk_size];
+          std::size_t other = column_position[partner[row]];
+          Arith_element inv_x = coeff_field_.inverse(other_columns.begin(other)->second,
+                                                     coeff_field_.characteristic()).first;
+          Arith_element w = coeff_field_.times_minus(inv_x, col[i].second);
+          col.erase(col.begin(), col.begin() + i);
+          plus_equal_column(col_tmp, col, other_columns.begin(other), other_columns.end(other), w);
+          col.swap(col_tmp);
+          i = 0;
+        }
+      }
+    };
+    Reduced_column col_tmp;
+    for (std::size_t dim = global_keys_by_dimension.size(); dim-- > 0;) {
+      global_keys.clear();
+      for (Simplex_key key : global_keys_by_dimension[dim]) {
+        if (partner[key] == no_key) global_keys.push_back(key);  // otherwise cleared
+      }
+      std::sort(global_keys.begin(), global_keys.end());
+      global_columns.resize(global_keys.size());
+#ifdef GUDHI_USE_TBB
+      tbb::parallel_for(std::size_t(0), global_keys.size(), compress_column);
+#else
+      for (std::size_t idx = 0; idx < global_keys.size(); ++idx) compress_column(idx);
+#endif
+      if (dim + 1 == global_keys_by_dimension.size()) {
+        reduce_transposed_columns(global_keys, global_columns, partner, column_position);
+        continue;
+      }
+      // The pivot of a compressed column can only be eliminated with another global column.
+      for (std::size_t idx = 0; idx < global_keys.size(); ++idx) {
+        Simplex_key key = global_keys[idx];
+        Reduced_column& col = global_columns[idx];
+        while (!col.empty() && partner[col.front().first] != no_key) {
+          const Reduced_column& other = global_columns[column_position[partner[col.front().first]]];
+          Arith_element inv_x = coeff_field_.inverse(other.front().second, coeff_field_.characteristic()).first;
+          Arith_element w = coeff_field_.times_minus(inv_x, col.front().second);
+          plus_equal_column(col_tmp, col, other.begin(), other.end(), w);
+          col.swap(col_tmp);
+        }
+        if (!col.empty()) {
+          partner[col.front().first] = key;
+          partner[key] = col.front().first;
+          column_position[key] = idx;
+        }
+      }
+    }
+
+    // Finite intervals by increasing death, then infinite intervals by increasing birth.
+    for (Simplex_key key = 0; key < num_simplices_; ++key) {
+      if (partner[key] != no_key && partner[key] < key) {
+        Simplex_handle birth = cpx_->simplex(partner[key]);
+        Simplex_handle death = cpx_->simplex(key);
+        if (interval_length_policy(birth, death)) {
+          persistent_pairs_.emplace_back(birth, death, coeff_field_.characteristic());
+        }
+      }
+    }
+    for (Simplex_key key = 0; key < num_simplices_; ++key) {
+      if (partner[key] == no_key) {
+        Simplex_handle birth = cpx_->simplex(key);
+        if (static_cast<int>(cpx_->dimension(birth)) < dim_max_) {
+          persistent_pairs_.emplace_back(birth, cpx_->null_simplex(), coeff_field_.characteristic());
+        }
+      }
+    }
+  }
+
+  /*
+   * Pairs the rows and the columns of the matrix whose column column_keys[i] is columns[i], by reducing its
+   * anti-transpose: the rows are reduced by decreasing key, and the pivot of a row is its smallest column key. The
+   * pairs are the same as with the columns, but for the highest dimension the fill-in is much smaller: reducing the
+   * columns merges the boundaries of growing regions, up to the whole domain of a periodic cubical complex.
+   */
+  void reduce_transposed_columns(const std::vector<Simplex_key>& column_keys,
+                                 const std::vector<Reduced_column>& columns, std::vector<Simplex_key>& partner,
+                                 std::vector<std::size_t>& pivot_row) {
+    const Simplex_key no_key = std::numeric_limits<Simplex_key>::max();
+    // Entries (row key, column key, coefficient), sorted by decreasing row key, then by decreasing column key.
+    std::vector<std::tuple<Simplex_key, Simplex_key, Arith_element>> entries;
+    for (std::size_t idx = 0; idx < columns.size(); ++idx) {
+      for (auto& entry : columns[idx]) entries.emplace_back(entry.first, column_keys[idx], entry.second);
+    }
+    std::sort(entries.begin(), entries.end(),
+              [](const std::tuple<Simplex_key, Simplex_key, Arith_element>& a,
+                 const std::tuple<Simplex_key, Simplex_key, Arith_element>& b) {
+                return std::get<0>(a) > std::get<0>(b) || (std::get<0>(a) == std::get<0>(b) &&
+                                                          std::get<1>(a) > std::get<1>(b));
+              });
+    // pivot_row[k] is the position in reduced_rows of the row whose pivot is the column of key k, for the columns
+    // which are already paired.
+    Reduced_matrix reduced_rows;
+    Reduced_column row, row_tmp;
+    for (auto it = entries.begin(); it != entries.end();) {
+      Simplex_key row_key = std::get<0>(*it);
+      row.clear();
+      for (; it != entries.end() && std::get<0>(*it) == row_key; ++it) {
+        row.emplace_back(std::get<1>(*it), std::get<2>(*it));
+      }
+      while (!row.empty() && partner[row.back().first] != no_key) {
+        std::size_t other = pivot_row[row.back().first];
+        Arith_element inv_x = coeff_field_.inverse(reduced_rows.pivot(other).second,
+                                                   coeff_field_.characteristic()).first;
+        Arith_element w = coeff_field_.times_minus(inv_x, row.back().second);
+        plus_equal_column(row_tmp, row, reduced_rows.begin(other), reduced_rows.end(other), w);
+        row.swap(row_tmp);
+      }
+      if (!row.empty()) {
+        pivot_row[row.back().first] = reduced_rows.push_back(row);
+        partner[row.back().first] = row_key;
+        partner[row_key] = row.back().first;
+      }
+    }
+  }
+
+  /*
+   * Compute the boundary of the simplex of the given key, sorted by decreasing key, with alternating coefficients.
+   */
+  void boundary_column(Reduced_column& col, Simplex_key key) {
+    col.clear();
+    Simplex_handle sigma = cpx_->simplex(key);
+    Arith_element coefficient[2] = {coeff_field_.times(coeff_field_.multiplicative_identity(), 1),
+                                    coeff_field_.times(coeff_field_.multiplicative_identity(), -1)};
+    int sign = cpx_->dimension(sigma) % 2;
+    for (auto sh : cpx_->boundary_simplex_range(sigma)) {
+      col.emplace_back(cpx_->key(sh), coefficient[sign]);
+      sign = 1 - sign;
+    }
+    std::sort(col.begin(), col.end(), [](const std::pair<Simplex_key, Arith_element>& a,
+                                         const std::pair<Simplex_key, Arith_element>& b) {
+      return a.first > b.first;
+    });
+    // A face may appear several times in the boundary of a cell, e.g. with periodic boundary conditions.
+    auto out = col.begin();
+    for (auto it = col.begin(); it != col.end();) {
+      Simplex_key face = it->first;
+      Arith_element x = it->second;
+      while (++it != col.end() && it->first == face) x = coeff_field_.plus_equal(x, it->second);
+      if (x != coeff_field_.additive_identity()) *out++ = std::make_pair(face, x);
+    }
+    col.erase(out, col.end());
+  }
+
+  /** \brief Adds the infinite intervals of dimension 0, from the union-find data structure. */
+  void compute_infinite_intervals_in_dimension_zero() {
     Simplex_key key;
     for (auto v_sh : cpx_->skeleton_simplex_range(0)) {  // for all 0-dimensional simplices
       key = cpx_->key(v_sh);
@@ -200,19 +646,69 @@ class Persistent_cohomology {
       persistent_pairs_.emplace_back(
           cpx_->simplex(zero_idx.second), cpx_->null_simplex(), coeff_field_.characteristic());
     }
-    // Compute infinite interval of dimension > 0
-    for (auto cocycle : transverse_idx_) {
-      persistent_pairs_.emplace_back(
-          cpx_->simplex(cocycle.first), cpx_->null_simplex(), cocycle.second.characteristics_);
+  }
+
+  /*
+   * Assign:    target <- col + w * [other_it, other_end), where all columns are sorted by decreasing key.
+   */
+  template<typename Entry_iterator>
+  void plus_equal_column(Reduced_column& target, const Reduced_column& col,
+                         Entry_iterator other_it, Entry_iterator other_end, Arith_element w) {
+    GUDHI_INSTRUMENT_COUNT("Persistent_cohomology::column_additions", 1);
+    target.clear();
+    auto col_it = col.begin();
+    while (col_it != col.end() && other_it != other_end) {
+      if (col_it->first > other_it->first) {
+        target.push_back(*col_it++);
+      } else if (col_it->first < other_it->first) {
+        target.emplace_back(other_it->first, coeff_field_.times(other_it->second, w));
+        ++other_it;
+      } else {
+        Arith_element x = coeff_field_.plus_times_equal(col_it->second, other_it->second, w);
+        if (x != coeff_field_.additive_identity()) target.emplace_back(col_it->first, x);
+        ++col_it;
+        ++other_it;
+      }
+    }
+    target.insert(target.end(), col_it, col.end());
+    for (; other_it != other_end; ++other_it) {
+      target.emplace_back(other_it->first, coeff_field_.times(other_it->second, w));
     }
   }
 
- private:
+  /** \brief Sorts the combination of coboundaries by decreasing key, and sums the coefficients of each key. */
+  void compress_combination(Reduced_column& combination) {
+    std::sort(combination.begin(), combination.end(),
+              [](const std::pair<Simplex_key, Arith_element>& a, const std::pair<Simplex_key, Arith_element>& b) {
+                return a.first > b.first;
+              });
+    auto out = combination.begin();
+    for (auto it = combination.begin(); it != combination.end();) {
+      std::pair<Simplex_key, Arith_element> entry = *it;
+      for (++it; it != combination.end() && it->first == entry.first; ++it)
+        entry.second = coeff_field_.plus_equal(entry.second, it->second);
+      if (entry.second != coeff_field_.additive_identity()) *out++ = entry;
+    }
+    combination.erase(out, combination.end());
+  }
+
   /** \brief Update the cohomology groups under the insertion of an edge.
    *
    * The 0-homology is maintained with a simple Union-Find data structure, which
    * explains the existance of a specific function of edge insertions. */
   void update_cohomology_groups_edge(Simplex_handle sigma) {
+    if (update_connected_components(sigma)) {
+      cpx_->assign_key(sigma, cpx_->null_key());
+    } else if (dim_max_ > 1) {  // If ku == kv, same connected component: create a 1-cocycle class.
+      create_cocycle(sigma, coeff_field_.multiplicative_identity(), coeff_field_.characteristic());
+    }
+  }
+
+  /** \brief Update the union-find data structure under the insertion of an edge.
+   *
+   * Returns true if the edge merges two connected components, in which case the
+   * corresponding finite interval of dimension 0 is recorded. */
+  bool update_connected_components(Simplex_handle sigma) {
     Simplex_handle u, v;
     boost::tie(u, v) = cpx_->endpoints(sigma);
 
@@ -272,10 +768,9 @@ class Persistent_cohomology {
           zero_cocycles_[ku] = idx_coc_v;
         }
       }
-      cpx_->assign_key(sigma, cpx_->null_key());
-    } else if (dim_max_ > 1) {  // If ku == kv, same connected component: create a 1-cocycle class.
-      create_cocycle(sigma, coeff_field_.multiplicative_identity(), coeff_field_.characteristic());
+      return true;
     }
+    return false;
   }
 
   /*
@@ -491,6 +986,7 @@ class Persistent_cohomology {
    */
   void plus_equal_column(Column & target, A_ds_type const& other  // value_type is pair<Simplex_key,Arith_element>
                          , Arith_element w) {
+    GUDHI_INSTRUMENT_COUNT("Persistent_cohomology::column_additions", 1);
     auto target_it = target.col_.begin();
     auto other_it = other.begin();
     while (target_it != target.col_.end() && other_it != other.end()) {
@@ -559,6 +1055,7 @@ class Persistent_cohomology {
    * feature exists in homology with Z/piZ coefficients.
    */
   void output_diagram(std::ostream& ostream = std::cout) {
+    GUDHI_INSTRUMENT_SCOPE("Persistent_cohomology::output_diagram");
     cmp_intervals_by_length cmp(cpx_);
     std::sort(std::begin(persistent_pairs_), std::end(persistent_pairs_), cmp);
     for (auto pair : persistent_pairs_) {
@@ -569,6 +1066,7 @@ class Persistent_cohomology {
   }
 
   void write_output_diagram(std::string diagram_name) {
+    GUDHI_INSTRUMENT_SCOPE("Persistent_cohomology::write_output_diagram");
     std::ofstream diagram_out(diagram_name.c_str());
     diagram_out.exceptions(diagram_out.failbit);
     cmp_intervals_by_length cmp(cpx_);
@@ -679,6 +1177,7 @@ class Persistent_cohomology {
    */
   std::vector< std::pair< Filtration_value , Filtration_value > >
   intervals_in_dimension(int dimension) {
+    GUDHI_INSTRUMENT_SCOPE("Persistent_cohomology::intervals_in_dimension");
     std::vector< std::pair< Filtration_value , Filtration_value > > result;
     // auto && pair, to avoid unnecessary copying
     for (auto && pair : persistent_pairs_) {
@@ -0,0 +1,136 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Clément Maria
+ *
+ *    Copyright (C) 2020 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef PERSISTENT_COHOMOLOGY_COFACET_ENUMERATOR_H_
+#define PERSISTENT_COHOMOLOGY_COFACET_ENUMERATOR_H_
+
+#include <vector>
+#include <algorithm>  // for std::reverse, std::lower_bound
+#include <cstddef>  // for std::size_t
+
+namespace Gudhi {
+
+namespace persistent_cohomology {
+
+/** \internal
+ * \brief Enumerates the cofacets of the simplices of a simplex tree on the fly, by following its children.
+ *
+ * Let the vertices of a simplex be \f$v_0 < \cdots < v_k\f$. A cofacet whose new vertex \f$w\f$ lies between
+ * \f$v_{i-1}\f$ and \f$v_i\f$ is a descendant of a sibling of the node of \f$v_0 \cdots v_i\f$, reached by following
+ * \f$v_i, \ldots, v_k\f$ from the node of \f$v_0 \cdots v_{i-1} w\f$. In particular the cofacets whose new vertex is
+ * the largest one are the children of the simplex. The new vertices smaller than \f$v_0\f$ are neighbors of
+ * \f$v_0\f$, hence the edges of each vertex towards its lower neighbors are stored, one handle per edge.
+ *
+ * \tparam SimplexTree must be a `Simplex_tree`, which is not modified while the enumerator is used.
+ */
+template<typename SimplexTree>
+class Cofacet_enumerator {
+ public:
+  typedef typename SimplexTree::Vertex_handle Vertex_handle;
+  typedef typename SimplexTree::Simplex_handle Simplex_handle;
+
+  explicit Cofacet_enumerator(SimplexTree& cpx)
+      : cpx_(&cpx) {
+    for (auto v : cpx.complex_vertex_range()) vertices_.push_back(v);
+    // The vertices are already sorted in the root of the simplex tree.
+    contiguous_vertices_ = vertices_.empty() ||
+        (vertices_.front() == 0 && vertices_.back() == static_cast<Vertex_handle>(vertices_.size() - 1));
+    // The edges {w, v} with w < v, by increasing w, are lower_edges_[offsets_[i]], ...,
+    // lower_edges_[offsets_[i + 1] - 1], where vertices_[i] = v.
+    offsets_.assign(vertices_.size() + 1, 0);
+    for_each_edge([this](Simplex_handle, Vertex_handle v) { ++offsets_[index(v) + 1]; });
+    for (std::size_t i = 0; i < vertices_.size(); ++i) offsets_[i + 1] += offsets_[i];
+    lower_edges_.resize(offsets_.back());
+    std::vector<std::size_t> next(offsets_.begin(), offsets_.end() - 1);
+    for_each_edge([this, &next](Simplex_handle edge, Vertex_handle v) { lower_edges_[next[index(v)]++] = edge; });
+  }
+
+  /** \brief Calls f(tau, i) for each cofacet tau of the simplex sh, where i is the position of the vertex of tau
+   * which is not in sh, the vertices of tau being sorted by increasing label, until f returns false.
+   *
+   * The cofacets are enumerated by increasing label of the vertex which is not in sh. Returns false if the
+   * enumeration was stopped by f. */
+  template<typename Function>
+  bool for_each_cofacet(Simplex_handle sh, Function&& f) {
+    simplex_.clear();
+    for (auto v : cpx_->simplex_vertex_range(sh)) simplex_.push_back(v);
+    std::reverse(simplex_.begin(), simplex_.end());
+    const std::size_t size = simplex_.size();
+    // path_[j] is the node of the prefix of length j + 1 of the simplex, path_[size - 1] = sh.
+    // The vertices are in the same order in the root.
+    std::size_t v0 = index(simplex_[0]);
+    path_.assign(1, cpx_->root()->members().begin() + v0);
+    for (std::size_t j = 1; j < size; ++j) path_.push_back(path_.back()->second.children()->find(simplex_[j]));
+    // The new vertex is smaller than all the vertices of the simplex, the cofacet is a descendant of a lower edge.
+    for (std::size_t e = offsets_[v0]; e < offsets_[v0 + 1]; ++e) {
+      Simplex_handle tau = descend(lower_edges_[e], 1);
+      if (tau != cpx_->null_simplex() && !f(tau, 0)) return false;
+    }
+    // The new vertex lies between simplex_[i - 1] and simplex_[i], it is a sibling of path_[i] before it.
+    for (std::size_t i = 1; i < size; ++i) {
+      auto& members = path_[i - 1]->second.children()->members();
+      for (auto w_it = members.begin(); w_it != path_[i]; ++w_it) {
+        Simplex_handle tau = descend(w_it, i);
+        if (tau != cpx_->null_simplex() && !f(tau, i)) return false;
+      }
+    }
+    // The new vertex is larger than all the vertices of the simplex, the cofacets are its children.
+    if (cpx_->has_children(sh)) {
+      auto& members = sh->second.children()->members();
+      for (auto tau = members.begin(); tau != members.end(); ++tau)
+        if (!f(tau, size)) return false;
+    }
+    return true;
+  }
+
+ private:
+  // Calls f(edge, v) for each edge {w, v} with w < v.
+  template<typename Function>
+  void for_each_edge(Function&& f) {
+    for (auto sh : cpx_->skeleton_simplex_range(1)) {
+      if (cpx_->dimension(sh) != 1) continue;
+      f(sh, *cpx_->simplex_vertex_range(sh).begin());
+    }
+  }
+
+  // Returns the descendant of sh by the vertices simplex_[first], simplex_[first + 1], ..., null_simplex() if there
+  // is none.
+  Simplex_handle descend(Simplex_handle sh, std::size_t first) const {
+    for (std::size_t j = first; j < simplex_.size(); ++j) {
+      if (!cpx_->has_children(sh)) return cpx_->null_simplex();
+      auto* children = sh->second.children();
+      sh = children->find(simplex_[j]);
+      if (sh == children->members().end()) return cpx_->null_simplex();
+    }
+    return sh;
+  }
+
+  std::size_t index(Vertex_handle v) const {
+    if (contiguous_vertices_) return static_cast<std::size_t>(v);
+    return std::lower_bound(vertices_.begin(), vertices_.end(), v) - vertices_.begin();
+  }
+
+  SimplexTree* cpx_;
+  // The vertices sorted by increasing label, and the edges towards their lower neighbors.
+  std::vector<Vertex_handle> vertices_;
+  // Whether the vertices are 0, 1, ..., and their index is their label.
+  bool contiguous_vertices_;
+  std::vector<std::size_t> offsets_;
+  std::vector<Simplex_handle> lower_edges_;
+  // Buffers for the vertices of a simplex, sorted by increasing label, and the nodes of its prefixes.
+  std::vector<Vertex_handle> simplex_;
+  std::vector<Simplex_handle> path_;
+};
+
+}  // namespace persistent_cohomology
+
+}  // namespace Gudhi
+
+#endif  // PERSISTENT_COHOMOLOGY_COFACET_ENUMERATOR_H_
@@ -0,0 +1,87 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Clément Maria
+ *
+ *    Copyright (C) 2020 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef PERSISTENT_COHOMOLOGY_COMPRESSED_COLUMN_MATRIX_H_
+#define PERSISTENT_COHOMOLOGY_COMPRESSED_COLUMN_MATRIX_H_
+
+#include <vector>
+#include <utility>  // for std::pair
+#include <cstddef>  // for std::size_t
+
+namespace Gudhi {
+
+namespace persistent_cohomology {
+
+/** \internal
+ * \brief Sparse matrix storing its columns one after the other in a single array.
+ *
+ * Columns are sorted by decreasing row index, so that the pivot of a column, the entry with the smallest row index,
+ * is its last entry. The matrix is built column by column with push_back. This is the storage of the reduced columns
+ * of the chunk reduction, and of the combinations of coboundaries which are the reduced columns of a given dimension
+ * in the compressed column reduction.
+ */
+template<typename Index, typename Element>
+class Compressed_column_matrix {
+ public:
+  /** \brief Non zero entry of a column, (row index, coefficient).*/
+  typedef std::pair<Index, Element> Entry;
+  /** \brief Type of a column being reduced, sorted by decreasing row index.*/
+  typedef std::vector<Entry> Column;
+  typedef typename std::vector<Entry>::const_iterator Entry_iterator;
+
+  Compressed_column_matrix()
+      : entries_(),
+        offsets_(1, 0) {
+  }
+
+  /** \brief Appends a column at the end of the matrix, and returns its position.*/
+  std::size_t push_back(const Column& col) {
+    entries_.insert(entries_.end(), col.begin(), col.end());
+    offsets_.push_back(entries_.size());
+    return offsets_.size() - 2;
+  }
+
+  /** \brief Returns the number of columns.*/
+  std::size_t size() const {
+    return offsets_.size() - 1;
+  }
+
+  /** \brief Returns an iterator to the first entry of the column at position idx.*/
+  Entry_iterator begin(std::size_t idx) const {
+    return entries_.begin() + offsets_[idx];
+  }
+
+  /** \brief Returns an iterator past the last entry of the column at position idx.*/
+  Entry_iterator end(std::size_t idx) const {
+    return entries_.begin() + offsets_[idx + 1];
+  }
+
+  /** \brief Returns the pivot, i.e. the entry with the smallest row index, of the column at position idx.
+   * The column must not be empty. */
+  const Entry& pivot(std::size_t idx) const {
+    return entries_[offsets_[idx + 1] - 1];
+  }
+
+  /** \brief Removes all the columns, but keeps the memory for reuse.*/
+  void clear() {
+    entries_.clear();
+    offsets_.resize(1);
+  }
+
+ private:
+  std::vector<Entry> entries_;
+  std::vector<std::size_t> offsets_;
+};
+
+}  // namespace persistent_cohomology
+
+}  // namespace Gudhi
+
+#endif  // PERSISTENT_COHOMOLOGY_COMPRESSED_COLUMN_MATRIX_H_
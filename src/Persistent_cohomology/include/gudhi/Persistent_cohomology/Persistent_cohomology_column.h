@@ -44,7 +44,7 @@ template<typename SimplexKey, typename ArithmeticElement>
 class Persistent_cohomology_cell : public base_hook_cam_h,
     public base_hook_cam_v {
  public:
-  template<class T1, class T2> friend class Persistent_cohomology;
+  template<class T1, class T2, class T3> friend class Persistent_cohomology;
   friend class Persistent_cohomology_column<SimplexKey, ArithmeticElement>;
 
   typedef Persistent_cohomology_column<SimplexKey, ArithmeticElement> Column;
@@ -73,7 +73,7 @@ class Persistent_cohomology_cell : public base_hook_cam_h,
 template<typename SimplexKey, typename ArithmeticElement>
 class Persistent_cohomology_column : public boost::intrusive::set_base_hook<
     boost::intrusive::link_mode<boost::intrusive::normal_link> > {
-  template<class T1, class T2> friend class Persistent_cohomology;
+  template<class T1, class T2, class T3> friend class Persistent_cohomology;
 
  public:
   typedef Persistent_cohomology_cell<SimplexKey, ArithmeticElement> Cell;
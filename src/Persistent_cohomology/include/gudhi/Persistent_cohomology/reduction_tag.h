@@ -0,0 +1,69 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Clément Maria
+ *
+ *    Copyright (C) 2020 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef PERSISTENT_COHOMOLOGY_REDUCTION_TAG_H_
+#define PERSISTENT_COHOMOLOGY_REDUCTION_TAG_H_
+
+namespace Gudhi {
+
+namespace persistent_cohomology {
+
+/** \brief Tag selecting the Compressed Annotation Matrix reduction of Persistent_cohomology.
+ *
+ * \ingroup persistent_cohomology
+ *
+ * This is the default reduction. It supports single and multi-field coefficients.
+ */
+struct Annotation_matrix_reduction {
+};
+
+/** \brief Tag selecting the compressed column reduction of Persistent_cohomology.
+ *
+ * \ingroup persistent_cohomology
+ *
+ * The 0-dimensional persistence is computed with a union-find data structure, then the coboundary matrix is reduced
+ * dimension by dimension, from the lowest to the highest, with the clearing (twist) optimization. The coboundary of
+ * a simplex is enumerated on the fly from the children of the simplex tree when its column is reduced, and the
+ * enumeration stops at the first cofacet with the filtration value of the simplex, which is the pivot. Most columns
+ * are reduced as they are, and are not stored. The others are stored as the combinations of coboundaries they are,
+ * contiguously in a Compressed_column_matrix. On Rips complexes, this reduction is faster than
+ * Annotation_matrix_reduction and uses about the same memory. The persistent pairs are the same, and are given in the
+ * same order, as with Annotation_matrix_reduction.
+ *
+ * The filtered complex must be a `Simplex_tree`, whose filtration is initialized by `initialize_filtration()` or
+ * `initialize_filtration_by_dimension()`.
+ * Only coefficient fields with a single characteristic (e.g. Field_Zp) are supported.
+ */
+struct Compressed_column_reduction {
+};
+
+/** \brief Tag selecting the chunk reduction of Persistent_cohomology.
+ *
+ * \ingroup persistent_cohomology
+ *
+ * The boundary matrix is split into chunks of consecutive columns in the filtration order. Each chunk is reduced
+ * independently, in parallel when TBB is available, with the clearing optimization and only with its own columns:
+ * a column whose pivot lies in its chunk gives a final persistent pair. The remaining columns are compressed, i.e.
+ * the rows already paired are removed from them, and are reduced together, the ones of the highest dimension through
+ * the anti-transposed matrix. This is efficient when most pairs are
+ * short compared to the size of a chunk, as for lower star filtrations of images (Bitmap_cubical_complex).
+ * The intervals are the same as with Annotation_matrix_reduction, the pairs of simplices realizing them may differ
+ * when several simplices have the same filtration value.
+ *
+ * Only coefficient fields with a single characteristic (e.g. Field_Zp) are supported.
+ */
+struct Chunk_reduction {
+};
+
+}  // namespace persistent_cohomology
+
+}  // namespace Gudhi
+
+#endif  // PERSISTENT_COHOMOLOGY_REDUCTION_TAG_H_
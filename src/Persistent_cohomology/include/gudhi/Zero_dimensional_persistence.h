@@ -0,0 +1,268 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Clément Maria
+ *
+ *    Copyright (C) 2020 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef ZERO_DIMENSIONAL_PERSISTENCE_H_
+#define ZERO_DIMENSIONAL_PERSISTENCE_H_
+
+#include <gudhi/Debug_utils.h>
+#include <gudhi/proximity_edges.h>
+#include <gudhi/Simplex_tree/Simplex_tree_radix_sort.h>  // for Filtration_radix_key, radix_sort_by_key
+
+#include <vector>
+#include <utility>  // for std::pair
+#include <algorithm>  // for std::max, std::stable_sort, std::lower_bound
+#include <limits>  // for std::numeric_limits
+#include <iterator>  // for std::begin, std::end
+#include <cstdint>  // for std::uint8_t
+#include <cstddef>  // for std::size_t
+#include <type_traits>  // for std::integral_constant, std::is_integral
+#include <stdexcept>  // for std::invalid_argument
+
+namespace Gudhi {
+
+namespace persistent_cohomology {
+
+/**
+ * \class Zero_dimensional_persistence
+ * \brief Persistent homology in dimension 0 of a filtered graph, computed with a union-find.
+ *
+ * \ingroup persistent_cohomology
+ *
+ * \details
+ * This class computes the same intervals of dimension 0 as `Persistent_cohomology` on a filtered complex, from its
+ * vertices and edges only: no `Simplex_tree` is built, and the higher dimensional simplices are never considered.
+ * The edges are sorted by filtration value with a radix sort (for integral and IEEE floating-point filtration values,
+ * with a fallback on `std::stable_sort` for the other types), and the connected components are maintained in a flat
+ * union-find, with union by rank and path halving. When two components merge, the younger one, i.e. the one whose
+ * oldest vertex has the greatest filtration value, dies (elder rule).
+ *
+ * The filtration value of an edge is the maximum of its given filtration value and of the filtration values of its
+ * vertices, so that the filtration is always valid.
+ *
+ * \tparam Filtration_value is the type used to store the filtration values.
+ */
+template<typename Filtration_value>
+class Zero_dimensional_persistence {
+ public:
+  /** \brief Type of the vertices, which are the integers 0 to `num_vertices() - 1`. */
+  typedef int Vertex_handle;
+  /**
+   * \brief Type of a persistence interval, (birth, death). The death of an infinite interval is
+   * `infinite_death()`.
+   */
+  typedef std::pair<Filtration_value, Filtration_value> Persistence_interval;
+
+  /** \brief Returns the death of the infinite intervals: `std::numeric_limits<Filtration_value>::infinity()` if
+   * `Filtration_value` has an infinity, e.g. for floating-point types, and `std::numeric_limits<Filtration_value>::max()`
+   * otherwise, e.g. for integral types.
+   */
+  static constexpr Filtration_value infinite_death() {
+    return std::numeric_limits<Filtration_value>::has_infinity ? std::numeric_limits<Filtration_value>::infinity()
+                                                               : (std::numeric_limits<Filtration_value>::max)();
+  }
+
+  /** \brief Zero_dimensional_persistence constructor from a filtered graph.
+   *
+   * @param[in] vertex_filtrations Range of the filtration values of the vertices, vertex \f$i\f$ being the
+   * \f$i\f$-th element.
+   * @param[in] edges Range of edges, each edge being a pair of vertices.
+   * @param[in] edge_filtrations Range of the filtration values of the edges, in the order of edges.
+   *
+   * The output of `Gudhi::compute_proximity_edges` can be given as is, with the vertices all born at 0.
+   */
+  template<typename VertexFiltrationRange, typename EdgeRange, typename EdgeFiltrationRange>
+  Zero_dimensional_persistence(const VertexFiltrationRange& vertex_filtrations, const EdgeRange& edges,
+                               const EdgeFiltrationRange& edge_filtrations)
+      : vertex_filtrations_(std::begin(vertex_filtrations), std::end(vertex_filtrations)) {
+    auto fil_it = std::begin(edge_filtrations);
+    for (const auto& edge : edges) {
+      GUDHI_CHECK(fil_it != std::end(edge_filtrations),
+                  std::invalid_argument("Zero_dimensional_persistence - fewer edge filtration values than edges"));
+      add_edge(static_cast<Vertex_handle>(edge.first), static_cast<Vertex_handle>(edge.second), *fil_it);
+      ++fil_it;
+    }
+  }
+
+  /** \brief Zero_dimensional_persistence constructor from the 1-skeleton of a Rips complex.
+   *
+   * @param[in] points Range of points.
+   * @param[in] threshold Rips value.
+   * @param[in] distance distance function that returns a `Filtration_value` from 2 given points.
+   *
+   * \tparam ForwardPointRange must be a range for which `std::begin` and `std::end` return input iterators on a
+   * point.
+   *
+   * \tparam Distance furnishes `operator()(const Point& p1, const Point& p2)`, where
+   * `Point` is a point from the `ForwardPointRange`, and that returns a `Filtration_value`.
+   */
+  template<typename ForwardPointRange, typename Distance>
+  Zero_dimensional_persistence(const ForwardPointRange& points, Filtration_value threshold, Distance distance) {
+    std::vector<std::pair<Vertex_handle, Vertex_handle>> edges;
+    std::vector<Filtration_value> edges_fil;
+    Vertex_handle num_vertices = compute_proximity_edges(points, threshold, distance, edges, edges_fil);
+    vertex_filtrations_.assign(num_vertices, 0);
+    edges_.reserve(edges.size());
+    for (std::size_t i = 0; i < edges.size(); ++i) add_edge(edges[i].first, edges[i].second, edges_fil[i]);
+  }
+
+  /** \brief Zero_dimensional_persistence constructor from the vertices and edges of a filtered complex.
+   *
+   * @param[in] cpx Filtered complex, e.g. a `Simplex_tree` or a `Bitmap_cubical_complex`. Only its simplices of
+   * dimension 0 and 1 are read, and the complex is not modified.
+   *
+   * \tparam FilteredComplex must provide `skeleton_simplex_range`, `dimension`, `filtration` and `endpoints`, as
+   * described in the `FilteredComplex` concept. If its `Simplex_handle` is an integral type, as for
+   * `Bitmap_cubical_complex`, it must be smaller than `num_simplices()`. Otherwise, the complex must provide
+   * `complex_vertex_range`, by increasing vertex, and `simplex_vertex_range`, as `Simplex_tree`.
+   */
+  template<typename FilteredComplex>
+  explicit Zero_dimensional_persistence(FilteredComplex& cpx) {
+    add_complex(cpx, std::is_integral<typename FilteredComplex::Simplex_handle>());
+  }
+
+  /** \brief Returns the number of vertices. */
+  std::size_t num_vertices() const { return vertex_filtrations_.size(); }
+
+  /** \brief Returns the number of edges. */
+  std::size_t num_edges() const { return edges_.size(); }
+
+  /** \brief Computes the persistence intervals of dimension 0.
+   *
+   * @param[in] min_interval_length The intervals of length less or equal to min_interval_length are discarded.
+   */
+  void compute_persistence(Filtration_value min_interval_length = 0) {
+    std::vector<std::size_t> order;
+    sort_edges(order, std::integral_constant<bool, simplex_tree::Filtration_radix_key<Filtration_value>::value>());
+
+    const Vertex_handle num_vertices = static_cast<Vertex_handle>(vertex_filtrations_.size());
+    // For each vertex, its parent in the union-find, or itself if it is a root.
+    std::vector<Vertex_handle> parent(num_vertices);
+    std::vector<std::uint8_t> rank(num_vertices, 0);
+    // For each root, the oldest vertex of its component.
+    std::vector<Vertex_handle> oldest(num_vertices);
+    for (Vertex_handle v = 0; v < num_vertices; ++v) parent[v] = oldest[v] = v;
+    auto find = [&parent](Vertex_handle v) {
+      while (parent[v] != v) {
+        parent[v] = parent[parent[v]];
+        v = parent[v];
+      }
+      return v;
+    };
+
+    intervals_.clear();
+    for (std::size_t idx : order) {
+      Vertex_handle u = find(edges_[idx].first);
+      Vertex_handle v = find(edges_[idx].second);
+      if (u == v) continue;
+      Filtration_value death = edge_filtrations_[idx];
+      // The elder rule: the component whose oldest vertex is born last dies.
+      Vertex_handle older = oldest[u], younger = oldest[v];
+      if (vertex_filtrations_[younger] < vertex_filtrations_[older]) std::swap(older, younger);
+      if (death - vertex_filtrations_[younger] > min_interval_length)
+        intervals_.emplace_back(vertex_filtrations_[younger], death);
+      if (rank[u] < rank[v]) std::swap(u, v);
+      if (rank[u] == rank[v]) ++rank[u];
+      parent[v] = u;
+      oldest[u] = older;
+    }
+    for (Vertex_handle v = 0; v < num_vertices; ++v) {
+      if (parent[v] == v)
+        intervals_.emplace_back(vertex_filtrations_[oldest[v]], infinite_death());
+    }
+  }
+
+  /** \brief Returns the persistence intervals of dimension 0, the finite ones by increasing death, then the infinite
+   * ones.
+   */
+  const std::vector<Persistence_interval>& intervals() const { return intervals_; }
+
+ private:
+  void add_edge(Vertex_handle u, Vertex_handle v, Filtration_value filtration) {
+    GUDHI_CHECK(u >= 0 && v >= 0 && static_cast<std::size_t>(std::max(u, v)) < vertex_filtrations_.size(),
+                std::invalid_argument("Zero_dimensional_persistence - edge vertex out of range"));
+    edges_.emplace_back(u, v);
+    edge_filtrations_.push_back(std::max(filtration, std::max(vertex_filtrations_[u], vertex_filtrations_[v])));
+  }
+
+  /** \brief Adds the vertices and edges of a complex whose simplex handles are indices. */
+  template<typename FilteredComplex>
+  void add_complex(FilteredComplex& cpx, std::true_type) {
+    std::vector<Vertex_handle> vertex_index(cpx.num_simplices(), -1);
+    for (auto sh : cpx.skeleton_simplex_range(0)) {
+      if (cpx.dimension(sh) != 0) continue;
+      vertex_index[sh] = static_cast<Vertex_handle>(vertex_filtrations_.size());
+      vertex_filtrations_.push_back(cpx.filtration(sh));
+    }
+    for (auto sh : cpx.skeleton_simplex_range(1)) {
+      if (cpx.dimension(sh) != 1) continue;
+      auto vertices = cpx.endpoints(sh);
+      add_edge(vertex_index[vertices.first], vertex_index[vertices.second], cpx.filtration(sh));
+    }
+  }
+
+  /** \brief Adds the vertices and edges of a simplicial complex, whose vertices are numbered by their rank. */
+  template<typename FilteredComplex>
+  void add_complex(FilteredComplex& cpx, std::false_type) {
+    std::vector<typename FilteredComplex::Vertex_handle> vertices;
+    for (auto v : cpx.complex_vertex_range()) vertices.push_back(v);
+    auto vertex_index = [&vertices](typename FilteredComplex::Vertex_handle v) {
+      return static_cast<Vertex_handle>(std::lower_bound(vertices.begin(), vertices.end(), v) - vertices.begin());
+    };
+    vertex_filtrations_.resize(vertices.size());
+    std::vector<std::pair<Vertex_handle, Vertex_handle>> edges;
+    std::vector<Filtration_value> edges_fil;
+    for (auto sh : cpx.skeleton_simplex_range(1)) {
+      auto simplex_vertices = cpx.simplex_vertex_range(sh);
+      auto it = simplex_vertices.begin();
+      Vertex_handle u = vertex_index(*it);
+      if (++it == simplex_vertices.end()) {
+        vertex_filtrations_[u] = cpx.filtration(sh);
+      } else {
+        edges.emplace_back(u, vertex_index(*it));
+        edges_fil.push_back(cpx.filtration(sh));
+      }
+    }
+    // The edges are added once the filtration values of all the vertices are known.
+    edges_.reserve(edges.size());
+    for (std::size_t i = 0; i < edges.size(); ++i) add_edge(edges[i].first, edges[i].second, edges_fil[i]);
+  }
+
+  /** \brief Computes the indices of the edges by increasing filtration value, with a radix sort. */
+  void sort_edges(std::vector<std::size_t>& order, std::true_type) const {
+    typedef simplex_tree::Filtration_radix_key<Filtration_value> Radix_key;
+    std::vector<std::pair<typename Radix_key::Key, std::size_t>> keys, buffer;
+    keys.reserve(edges_.size());
+    for (std::size_t i = 0; i < edges_.size(); ++i) keys.emplace_back(Radix_key::key(edge_filtrations_[i]), i);
+    simplex_tree::radix_sort_by_key(keys, buffer);
+    order.clear();
+    order.reserve(keys.size());
+    for (const auto& key : keys) order.push_back(key.second);
+  }
+
+  void sort_edges(std::vector<std::size_t>& order, std::false_type) const {
+    order.resize(edges_.size());
+    for (std::size_t i = 0; i < order.size(); ++i) order[i] = i;
+    std::stable_sort(order.begin(), order.end(),
+                     [this](std::size_t a, std::size_t b) { return edge_filtrations_[a] < edge_filtrations_[b]; });
+  }
+
+ private:
+  std::vector<Filtration_value> vertex_filtrations_;
+  std::vector<std::pair<Vertex_handle, Vertex_handle>> edges_;
+  std::vector<Filtration_value> edge_filtrations_;
+  // Persistence intervals of dimension 0.
+  std::vector<Persistence_interval> intervals_;
+};
+
+}  // namespace persistent_cohomology
+
+}  // namespace Gudhi
+
+#endif  // ZERO_DIMENSIONAL_PERSISTENCE_H_
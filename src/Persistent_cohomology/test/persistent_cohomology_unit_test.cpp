@@ -5,6 +5,9 @@
 #include <cmath> // float comparison
 #include <limits>
 #include <cstdint>  // for std::uint8_t
+#include <cstdlib>  // for std::rand
+#include <tuple>
+#include <vector>
 
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MODULE "persistent_cohomology"
@@ -14,6 +17,7 @@
 #include <gudhi/reader_utils.h>
 #include <gudhi/Simplex_tree.h>
 #include <gudhi/Persistent_cohomology.h>
+#include <gudhi/Zero_dimensional_persistence.h>
 
 using namespace Gudhi;
 using namespace Gudhi::persistent_cohomology;
@@ -210,3 +214,235 @@ BOOST_AUTO_TEST_CASE( persistence_constructor_exception )
   BOOST_CHECK_THROW(Mini_st_persistence pcoh2(st), std::out_of_range);
 
 }
+
+template<class FilteredComplex>
+void test_compressed_column_reduction(FilteredComplex& st, int coefficient, double min_persistence,
+                                      bool persistence_dim_max) {
+  using Cam_persistence = Persistent_cohomology<FilteredComplex, Field_Zp>;
+  using Compressed_persistence = Persistent_cohomology<FilteredComplex, Field_Zp, Compressed_column_reduction>;
+  // Both constructors assign the keys in the order of the filtration, the annotation matrix modifies some of them.
+  Cam_persistence cam_pcoh(st, persistence_dim_max);
+  cam_pcoh.init_coefficients(coefficient);
+  cam_pcoh.compute_persistent_cohomology(min_persistence);
+  auto cam_pairs = cam_pcoh.get_persistent_pairs();
+
+  Compressed_persistence compressed_pcoh(st, persistence_dim_max);
+  compressed_pcoh.init_coefficients(coefficient);
+  compressed_pcoh.compute_persistent_cohomology(min_persistence);
+  auto compressed_pairs = compressed_pcoh.get_persistent_pairs();
+
+  std::clog << "Z/" << coefficient << "Z - min_persistence=" << min_persistence << " - persistence_dim_max="
+      << persistence_dim_max << " - " << cam_pairs.size() << " intervals" << std::endl;
+  BOOST_CHECK(cam_pairs == compressed_pairs);
+  BOOST_CHECK(cam_pcoh.betti_numbers() == compressed_pcoh.betti_numbers());
+}
+
+BOOST_AUTO_TEST_CASE( compressed_column_reduction_same_pairs )
+{
+  std::ifstream simplex_tree_stream("simplex_tree_file_for_unit_test.txt");
+  typeST st;
+  simplex_tree_stream >> st;
+  st.initialize_filtration();
+
+  for (int coefficient : {2, 3, 5, 11}) {
+    for (double min_persistence : {0., 1.}) {
+      test_compressed_column_reduction(st, coefficient, min_persistence, false);
+      test_compressed_column_reduction(st, coefficient, min_persistence, true);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE( compressed_column_reduction_random_flag_complex )
+{
+  // Flag complex of a random graph, with random filtration values on the edges.
+  std::srand(42);
+  typeST st;
+  const int nb_vertices = 40;
+  for (int u = 0; u < nb_vertices; ++u) {
+    st.insert_simplex({u}, 0.);
+    for (int v = 0; v < u; ++v) {
+      if (std::rand() % 2 == 0)
+        st.insert_simplex({v, u}, static_cast<double>(std::rand() % 100));
+    }
+  }
+  st.expansion(3);
+  st.initialize_filtration();
+  std::clog << "Random flag complex with " << st.num_simplices() << " simplices - dimension= " << st.dimension()
+      << std::endl;
+
+  for (int coefficient : {2, 3, 7}) {
+    test_compressed_column_reduction(st, coefficient, 0., false);
+    test_compressed_column_reduction(st, coefficient, 0., true);
+  }
+  // Simplices with the same filtration value are ordered differently.
+  st.initialize_filtration_by_dimension();
+  for (int coefficient : {2, 3, 7}) {
+    test_compressed_column_reduction(st, coefficient, 0., false);
+  }
+}
+
+BOOST_AUTO_TEST_CASE( compressed_column_reduction_non_contiguous_vertices )
+{
+  // Flag complex of a random graph, whose vertices are not 0, 1, ..., n - 1.
+  std::srand(7);
+  typeST st;
+  const int nb_vertices = 30;
+  for (int u = 0; u < nb_vertices; ++u) {
+    st.insert_simplex({3 * u + 1}, 0.);
+    for (int v = 0; v < u; ++v) {
+      if (std::rand() % 3 != 0)
+        st.insert_simplex({3 * v + 1, 3 * u + 1}, static_cast<double>(std::rand() % 20));
+    }
+  }
+  st.expansion(3);
+  st.initialize_filtration();
+
+  test_compressed_column_reduction(st, 2, 0., false);
+  test_compressed_column_reduction(st, 5, 0., true);
+}
+
+BOOST_AUTO_TEST_CASE( chunk_reduction_same_intervals )
+{
+  std::srand(7);
+  typeST st;
+  const int nb_vertices = 40;
+  for (int u = 0; u < nb_vertices; ++u) {
+    st.insert_simplex({u}, 0.);
+    for (int v = 0; v < u; ++v) {
+      if (std::rand() % 2 == 0)
+        st.insert_simplex({v, u}, static_cast<double>(std::rand() % 100));
+    }
+  }
+  st.expansion(3);
+  st.initialize_filtration();
+
+  for (int coefficient : {2, 3}) {
+    for (bool persistence_dim_max : {false, true}) {
+      // The pairs of simplices may differ between the reductions when simplices have the same filtration value.
+      std::vector<std::tuple<int, double, double>> intervals[2];
+      Persistent_cohomology<typeST, Field_Zp> cam_pcoh(st, persistence_dim_max);
+      cam_pcoh.init_coefficients(coefficient);
+      cam_pcoh.compute_persistent_cohomology(1.);
+      Persistent_cohomology<typeST, Field_Zp> chunk_pcoh(st, persistence_dim_max);
+      chunk_pcoh.init_coefficients(coefficient);
+      chunk_pcoh.compute_persistent_cohomology(1., Chunk_reduction());
+      int i = 0;
+      for (auto pcoh : {&cam_pcoh, &chunk_pcoh}) {
+        for (auto& pair : pcoh->get_persistent_pairs()) {
+          intervals[i].emplace_back(st.dimension(get<0>(pair)), st.filtration(get<0>(pair)),
+                                    st.filtration(get<1>(pair)));
+        }
+        std::sort(intervals[i].begin(), intervals[i].end());
+        ++i;
+      }
+      std::clog << "Z/" << coefficient << "Z - persistence_dim_max=" << persistence_dim_max << " - "
+          << intervals[0].size() << " intervals" << std::endl;
+      BOOST_CHECK(intervals[0] == intervals[1]);
+      BOOST_CHECK(cam_pcoh.betti_numbers() == chunk_pcoh.betti_numbers());
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE( chunk_reduction_transposed_top_dimension )
+{
+  // Random flag complex of dimension 2, whose triangles kill 1-cycles born in other chunks: the global columns of
+  // the top dimension are reduced through the anti-transposed matrix, and the top dimension intervals are not
+  // output.
+  std::srand(13);
+  typeST st;
+  const int nb_vertices = 60;
+  for (int u = 0; u < nb_vertices; ++u) {
+    st.insert_simplex({u}, 0.);
+    for (int v = 0; v < u; ++v) {
+      if (std::rand() % 4 == 0)
+        st.insert_simplex({v, u}, static_cast<double>(std::rand() % 1000));
+    }
+  }
+  st.expansion(2);
+  st.initialize_filtration();
+
+  std::vector<std::tuple<int, double, double>> intervals[2];
+  Persistent_cohomology<typeST, Field_Zp> cam_pcoh(st, false);
+  cam_pcoh.init_coefficients(3);
+  cam_pcoh.compute_persistent_cohomology(0.);
+  Persistent_cohomology<typeST, Field_Zp, Chunk_reduction> chunk_pcoh(st, false);
+  chunk_pcoh.init_coefficients(3);
+  chunk_pcoh.compute_persistent_cohomology(0.);
+  auto get_intervals = [&st](const std::vector<std::tuple<typeST::Simplex_handle, typeST::Simplex_handle, int>>& pairs,
+                              std::vector<std::tuple<int, double, double>>& intervals) {
+    for (auto& pair : pairs) {
+      BOOST_CHECK(st.dimension(get<0>(pair)) < 2);
+      intervals.emplace_back(st.dimension(get<0>(pair)), st.filtration(get<0>(pair)), st.filtration(get<1>(pair)));
+    }
+    std::sort(intervals.begin(), intervals.end());
+  };
+  get_intervals(cam_pcoh.get_persistent_pairs(), intervals[0]);
+  get_intervals(chunk_pcoh.get_persistent_pairs(), intervals[1]);
+  std::clog << st.num_simplices() << " simplices - " << intervals[0].size() << " intervals" << std::endl;
+  BOOST_CHECK(intervals[0] == intervals[1]);
+  BOOST_CHECK(cam_pcoh.betti_numbers() == chunk_pcoh.betti_numbers());
+}
+
+BOOST_AUTO_TEST_CASE( zero_dimensional_persistence_same_intervals )
+{
+  std::srand(11);
+  typeST st;
+  std::vector<double> vertex_filtrations;
+  std::vector<std::pair<int, int>> edges;
+  std::vector<double> edge_filtrations;
+  const int nb_vertices = 200;
+  for (int u = 0; u < nb_vertices; ++u) {
+    vertex_filtrations.push_back(static_cast<double>(std::rand() % 20));
+    st.insert_simplex({u}, vertex_filtrations.back());
+  }
+  for (int u = 0; u < nb_vertices; ++u) {
+    for (int v = 0; v < u; ++v) {
+      if (std::rand() % 50 == 0) {
+        // Some edges are given below the filtration values of their vertices.
+        edges.emplace_back(u, v);
+        edge_filtrations.push_back(static_cast<double>(std::rand() % 100));
+        st.insert_simplex({v, u}, std::max(edge_filtrations.back(),
+                                           std::max(vertex_filtrations[u], vertex_filtrations[v])));
+      }
+    }
+  }
+  st.initialize_filtration();
+
+  Persistent_cohomology<typeST, Field_Zp> pcoh(st);
+  pcoh.init_coefficients(2);
+  pcoh.compute_persistent_cohomology(1.);
+  std::vector<std::pair<double, double>> expected;
+  for (auto& interval : pcoh.intervals_in_dimension(0)) expected.push_back(interval);
+  std::sort(expected.begin(), expected.end());
+  std::clog << expected.size() << " intervals of dimension 0" << std::endl;
+
+  Zero_dimensional_persistence<double> from_graph(vertex_filtrations, edges, edge_filtrations);
+  Zero_dimensional_persistence<double> from_complex(st);
+  BOOST_CHECK(from_graph.num_edges() == edges.size());
+  BOOST_CHECK(from_complex.num_vertices() == static_cast<std::size_t>(nb_vertices));
+  for (auto zero_pers : {&from_graph, &from_complex}) {
+    zero_pers->compute_persistence(1.);
+    std::vector<std::pair<double, double>> intervals = zero_pers->intervals();
+    std::sort(intervals.begin(), intervals.end());
+    BOOST_CHECK(intervals == expected);
+  }
+}
+
+BOOST_AUTO_TEST_CASE( zero_dimensional_persistence_integral_filtration )
+{
+  // Components {0, 1}, {2, 3} and {4}.
+  std::vector<int> vertex_filtrations = {0, 1, 2, 0, 3};
+  std::vector<std::pair<int, int>> edges = {{0, 1}, {2, 3}};
+  std::vector<int> edge_filtrations = {4, 5};
+  Zero_dimensional_persistence<int> zero_pers(vertex_filtrations, edges, edge_filtrations);
+  zero_pers.compute_persistence();
+
+  // int has no infinity, the infinite intervals must not die at 0.
+  const int inf = Zero_dimensional_persistence<int>::infinite_death();
+  BOOST_CHECK(inf == std::numeric_limits<int>::max());
+  BOOST_CHECK(Zero_dimensional_persistence<double>::infinite_death() == std::numeric_limits<double>::infinity());
+  std::vector<std::pair<int, int>> intervals = zero_pers.intervals();
+  std::sort(intervals.begin(), intervals.end());
+  std::vector<std::pair<int, int>> expected = {{0, inf}, {0, inf}, {1, 4}, {2, 5}, {3, inf}};
+  BOOST_CHECK(intervals == expected);
+}
@@ -0,0 +1,70 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Clément Maria
+ *
+ *    Copyright (C) 2020 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#include <gudhi/proximity_edges.h>
+#include <gudhi/distance_functions.h>
+#include <gudhi/Points_off_io.h>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <utility>  // for std::pair
+#include <cstdlib>  // for std::atof, EXIT_FAILURE
+
+using Point = std::vector<double>;
+using Filtration_value = double;
+using Edge = std::pair<int, int>;
+
+/* Computes the edges of the proximity graph with the given distance and prints the elapsed time. */
+template<typename Distance>
+void timing_proximity_edges(const std::vector<Point>& points, Filtration_value threshold, Distance distance,
+                            std::vector<Edge>& edges, std::vector<Filtration_value>& edges_fil,
+                            const std::string& name) {
+  auto start = std::chrono::system_clock::now();
+  Gudhi::compute_proximity_edges(points, threshold, distance, edges, edges_fil);
+  auto end = std::chrono::system_clock::now();
+  std::clog << "  " << name << ": " << edges.size() << " edges in "
+      << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms.\n";
+}
+
+/* Timings for the computation of the edges of the Rips graph with the generic loop over all pairs of points and with
+ * the dedicated computation for the Euclidean distance. The points are by default 10000 points sampling a Klein
+ * bottle embedded in dimension 5.
+ * Usage: rips_proximity_graph_benchmark [off_file [threshold ...]]
+ */
+int main(int argc, char * argv[]) {
+  std::string off_file_points = "Kl.off";
+  std::vector<Filtration_value> thresholds = {0.1, 0.27, 1.};
+  if (argc > 1) off_file_points = argv[1];
+  if (argc > 2) {
+    thresholds.clear();
+    for (int i = 2; i < argc; ++i) thresholds.push_back(std::atof(argv[i]));
+  }
+
+  Gudhi::Points_off_reader<Point> off_reader(off_file_points);
+  const std::vector<Point>& points = off_reader.get_point_cloud();
+  // Same computation as Gudhi::Euclidean_distance, but not recognized as the Euclidean distance
+  auto generic_distance = [](const Point& p1, const Point& p2) { return Gudhi::Euclidean_distance()(p1, p2); };
+
+  for (Filtration_value threshold : thresholds) {
+    std::clog << "Proximity graph of " << points.size() << " points - threshold = " << threshold << "\n";
+    std::vector<Edge> generic_edges, euclidean_edges;
+    std::vector<Filtration_value> generic_edges_fil, euclidean_edges_fil;
+    timing_proximity_edges(points, threshold, generic_distance, generic_edges, generic_edges_fil, "generic");
+    timing_proximity_edges(points, threshold, Gudhi::Euclidean_distance(), euclidean_edges, euclidean_edges_fil,
+                           "Euclidean");
+    if (generic_edges != euclidean_edges || generic_edges_fil != euclidean_edges_fil) {
+      std::cerr << "  Error: the edges differ.\n";
+      return EXIT_FAILURE;
+    }
+  }
+  return 0;
+}
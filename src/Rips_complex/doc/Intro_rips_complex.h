@@ -49,6 +49,9 @@ namespace rips_complex {
  * In order to build this complex, the algorithm first builds the graph.
  * The filtration value of each edge is computed from a user-given distance
  * function, or directly read from the distance matrix.
+ * With `Gudhi::Euclidean_distance` on points given by ranges of floating-point coordinates, only the pairs of points
+ * that are close along one axis are compared, by vectorized blocks and in parallel with TBB, and the graph is the same
+ * as the one computed from all the pairs of points.
  * In a second step, this graph is inserted in a simplicial complex, which then
  * gets expanded to a flag complex.
  * 
@@ -102,6 +105,19 @@ namespace rips_complex {
  * number of higher-dimensional simplices may not be monotonous when
  * \f$\frac12\leq\epsilon\leq 1\f$.
  *
+ * \section ripspersistence Rips persistence without the complex
+ *
+ * When only the persistence of the Rips complex is needed, `Rips_persistence` computes the same intervals as
+ * `Rips_complex::create_complex` followed by `Gudhi::persistent_cohomology::Persistent_cohomology` with
+ * coefficients in \f$\mathbb{Z}/p\mathbb{Z}\f$, without inserting the simplices in a `Simplex_tree`. It is constructed
+ * from the same inputs as `Rips_complex`, a point cloud with a distance function or a distance matrix, and a threshold.
+ *
+ * A simplex is identified by its index in the combinatorial number system, and its cofacets are enumerated from the
+ * common neighbors of its vertices in the one skeleton graph when needed. The coboundary matrix is reduced dimension
+ * by dimension with the clearing optimization, and the columns forming an apparent pair with one of their cofacets
+ * are not reduced. Only the simplices of the dimension being reduced and the coefficients of the reduction are kept
+ * in memory, at the price of enumerating some coboundaries several times.
+ *
  * \section ripspointsdistance Point cloud and distance function
  * 
  * \subsection ripspointscloudexample Example from a point cloud and a distance function
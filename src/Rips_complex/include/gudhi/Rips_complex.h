@@ -13,6 +13,8 @@
 
 #include <gudhi/Debug_utils.h>
 #include <gudhi/graph_simplicial_complex.h>
+#include <gudhi/proximity_edges.h>
+#include <gudhi/Instrumentation.h>
 
 #include <boost/graph/adjacency_list.hpp>
 
@@ -101,6 +103,7 @@ class Rips_complex {
   void create_complex(SimplicialComplexForRips& complex, int dim_max) {
     GUDHI_CHECK(complex.num_vertices() == 0,
                 std::invalid_argument("Rips_complex::create_complex - simplicial complex is not empty"));
+    GUDHI_INSTRUMENT_SCOPE("Rips_complex::create_complex");
 
     // insert the proximity graph in the simplicial complex
     complex.insert_graph(rips_skeleton_graph_);
@@ -123,6 +126,7 @@ class Rips_complex {
   template< typename ForwardPointRange, typename Distance >
   void compute_proximity_graph(const ForwardPointRange& points, Filtration_value threshold,
                Distance distance) {
+    GUDHI_INSTRUMENT_SCOPE("Rips_complex::compute_proximity_graph");
     std::vector< std::pair< Vertex_handle, Vertex_handle > > edges;
     std::vector< Filtration_value > edges_fil;
 
@@ -131,17 +135,7 @@ class Rips_complex {
     // distance function between points u and v is smaller than threshold.
     // --------------------------------------------------------------------------------------------
     // Creates the vector of edges and its filtration values (returned by distance function)
-    Vertex_handle idx_u = 0;
-    for (auto it_u = std::begin(points); it_u != std::end(points); ++it_u, ++idx_u) {
-      Vertex_handle idx_v = idx_u + 1;
-      for (auto it_v = it_u + 1; it_v != std::end(points); ++it_v, ++idx_v) {
-        Filtration_value fil = distance(*it_u, *it_v);
-        if (fil <= threshold) {
-          edges.emplace_back(idx_u, idx_v);
-          edges_fil.push_back(fil);
-        }
-      }
-    }
+    Vertex_handle idx_u = compute_proximity_edges(points, threshold, distance, edges, edges_fil);
 
     // --------------------------------------------------------------------------------------------
     // Creates the proximity graph from edges and sets the property with the filtration value.
@@ -0,0 +1,491 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Clément Maria
+ *
+ *    Copyright (C) 2020 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef RIPS_PERSISTENCE_H_
+#define RIPS_PERSISTENCE_H_
+
+#include <gudhi/Debug_utils.h>
+#include <gudhi/proximity_edges.h>
+
+#include <boost/range/irange.hpp>
+
+#include <vector>
+#include <queue>  // for std::priority_queue
+#include <unordered_map>
+#include <algorithm>  // for std::sort, std::max
+#include <utility>  // for std::pair
+#include <limits>  // for std::numeric_limits
+#include <cstdint>  // for std::int64_t
+#include <stdexcept>  // for std::invalid_argument, std::overflow_error
+
+namespace Gudhi {
+
+namespace rips_complex {
+
+/**
+ * \class Rips_persistence
+ * \brief Persistent homology of a Rips complex, computed without building the complex.
+ *
+ * \ingroup rips_complex
+ *
+ * \details
+ * This class computes the same persistence intervals as `Rips_complex::create_complex` followed by
+ * `Gudhi::persistent_cohomology::Persistent_cohomology` on the resulting `Simplex_tree`, with coefficients in
+ * \f$\mathbb{Z}/p\mathbb{Z}\f$. The simplices are never stored in a simplicial complex: a simplex is represented by
+ * its index in the combinatorial number system, and its cofacets are enumerated from the neighbors of its vertices
+ * in the graph of edges of length at most the threshold. Only this graph, the simplices of the dimension being reduced
+ * and the reduction state are kept in memory.
+ *
+ * The coboundary matrix is reduced dimension by dimension in reverse filtration order, with the clearing optimization.
+ * A column whose simplex has a cofacet of same filtration value, which is not already the pivot of another column,
+ * forms an apparent pair with it and is not reduced. The columns added during the reduction are not stored, only the
+ * coefficients of the reduction are, and the coboundaries are enumerated again when needed.
+ *
+ * \tparam Filtration_value is the type used to store the filtration values, i.e. the distances.
+ */
+template<typename Filtration_value>
+class Rips_persistence {
+ private:
+  typedef int Vertex_handle;
+  // Index of a simplex in the combinatorial number system.
+  typedef std::int64_t Simplex_index;
+  typedef int Coefficient;
+  // Neighbor of a vertex, with the length of the edge.
+  typedef std::pair<Vertex_handle, Filtration_value> Neighbor;
+
+  // Simplex with its filtration value and a coefficient.
+  struct Simplex_entry {
+    Simplex_entry(Filtration_value filtration, Simplex_index index, Coefficient coefficient)
+        : filtration_(filtration),
+          index_(index),
+          coefficient_(coefficient) {
+    }
+    Filtration_value filtration_;
+    Simplex_index index_;
+    Coefficient coefficient_;
+  };
+
+  // Reverse filtration order: decreasing filtration value, then increasing index.
+  struct Is_after_in_filtration {
+    bool operator()(const Simplex_entry& a, const Simplex_entry& b) const {
+      if (a.filtration_ != b.filtration_) return a.filtration_ > b.filtration_;
+      return a.index_ < b.index_;
+    }
+  };
+
+  // Column in a heap, whose top is the entry first in the filtration order. Entries with the same index are summed
+  // when popped.
+  typedef std::priority_queue<Simplex_entry, std::vector<Simplex_entry>, Is_after_in_filtration> Working_column;
+
+ public:
+  /**
+   * \brief Type of a persistence interval, (birth, death). The death of an infinite interval is
+   * `std::numeric_limits<Filtration_value>::infinity()`.
+   */
+  typedef std::pair<Filtration_value, Filtration_value> Persistence_interval;
+
+  /** \brief Rips_persistence constructor from a list of points.
+   *
+   * @param[in] points Range of points.
+   * @param[in] threshold Rips value.
+   * @param[in] distance distance function that returns a `Filtration_value` from 2 given points.
+   *
+   * \tparam ForwardPointRange must be a range for which `std::begin` and `std::end` return input iterators on a
+   * point.
+   *
+   * \tparam Distance furnishes `operator()(const Point& p1, const Point& p2)`, where
+   * `Point` is a point from the `ForwardPointRange`, and that returns a `Filtration_value`.
+   */
+  template<typename ForwardPointRange, typename Distance >
+  Rips_persistence(const ForwardPointRange& points, Filtration_value threshold, Distance distance)
+      : threshold_(threshold) {
+    compute_neighbors(points, distance);
+  }
+
+  /** \brief Rips_persistence constructor from a distance matrix.
+   *
+   * @param[in] distance_matrix Range of distances.
+   * @param[in] threshold Rips value.
+   *
+   * \tparam DistanceMatrix must have a `size()` method and on which `distance_matrix[i][j]` returns
+   * the distance between points \f$i\f$ and \f$j\f$ as long as \f$ 0 \leqslant j < i \leqslant
+   * distance\_matrix.size().\f$
+   */
+  template<typename DistanceMatrix>
+  Rips_persistence(const DistanceMatrix& distance_matrix, Filtration_value threshold)
+      : threshold_(threshold) {
+    compute_neighbors(boost::irange((size_t)0, distance_matrix.size()),
+                            [&](size_t i, size_t j){return distance_matrix[j][i];});
+  }
+
+  /** \brief Computes the persistent homology of the Rips complex expanded until dimension dim_max.
+   *
+   * As for the persistence of `Rips_complex::create_complex(st, dim_max)`, the intervals are computed in dimension
+   * 0 to d - 1, where d is the dimension of the Rips complex, i.e. dim_max, or less if no simplex of dimension dim_max
+   * has all its edges of length at most the threshold. There are always intervals in dimension 0.
+   *
+   * @param[in] dim_max Maximal dimension of the simplices of the Rips complex.
+   * @param[in] coefficient Characteristic p of the coefficient field \f$\mathbb{Z}/p\mathbb{Z}\f$, must be prime.
+   * @param[in] min_interval_length The intervals of length less or equal to min_interval_length are discarded.
+   * @exception std::overflow_error If the simplices of dimension dim_max cannot be indexed on 64 bits.
+   */
+  void compute_persistence(int dim_max, int coefficient = 2, Filtration_value min_interval_length = 0) {
+    GUDHI_CHECK(coefficient > 1, std::invalid_argument("Rips_persistence::compute_persistence - coefficient must "
+                                                       "be a prime number"));
+    modulus_ = coefficient;
+    min_interval_length_ = min_interval_length;
+    intervals_.assign(std::max(dim_max, 0), std::vector<Persistence_interval>());
+    if (dim_max < 1) return;
+    init_binomial_coefficients(dim_max + 1);
+    init_multiplicative_inverses();
+
+    std::vector<Simplex_entry> simplices, columns_to_reduce;
+    Pivot_map pivot_column_index;
+    compute_dim_0_pairs(simplices, columns_to_reduce, dim_max);
+    for (int dim = 1; dim < dim_max; ++dim) {
+      // The Rips complex has dimension dim, there is no interval in this dimension.
+      if (!has_cofacet(simplices, dim)) {
+        intervals_.resize(dim);
+        break;
+      }
+      pivot_column_index.clear();
+      pivot_column_index.reserve(columns_to_reduce.size());
+      compute_pairs(columns_to_reduce, pivot_column_index, dim);
+      if (dim < dim_max - 1) assemble_columns_to_reduce(simplices, columns_to_reduce, pivot_column_index, dim + 1);
+    }
+  }
+
+  /** @brief Returns persistence intervals for a given dimension.
+   * @param[in] dimension Dimension to get the birth and death pairs from.
+   * @return A vector of persistence intervals (birth and death) on a fixed dimension.
+   */
+  std::vector<Persistence_interval> intervals_in_dimension(int dimension) const {
+    if (dimension < 0 || dimension >= static_cast<int>(intervals_.size())) return {};
+    return intervals_[dimension];
+  }
+
+ private:
+  // Pivot (index of a simplex of dimension dim + 1) -> (position of the column in columns_to_reduce, coefficient of
+  // the pivot in the reduced column).
+  typedef std::unordered_map<Simplex_index, std::pair<std::size_t, Coefficient>> Pivot_map;
+
+  /** \brief Computes, for each point, the points at distance at most threshold_, by decreasing index. */
+  template<typename ForwardPointRange, typename Distance>
+  void compute_neighbors(const ForwardPointRange& points, Distance distance) {
+    std::vector<std::pair<Vertex_handle, Vertex_handle>> edges;
+    std::vector<Filtration_value> edges_fil;
+    num_vertices_ = compute_proximity_edges(points, threshold_, distance, edges, edges_fil);
+    // The edges are sorted lexicographically, so the neighbors are by increasing index.
+    neighbors_.assign(num_vertices_, std::vector<Neighbor>());
+    for (std::size_t i = 0; i < edges.size(); ++i) {
+      neighbors_[edges[i].first].emplace_back(edges[i].second, edges_fil[i]);
+      neighbors_[edges[i].second].emplace_back(edges[i].first, edges_fil[i]);
+    }
+    for (auto& neighbors : neighbors_) std::reverse(neighbors.begin(), neighbors.end());
+  }
+
+  /** \brief Tabulates the binomial coefficients C(n, k) for n up to the number of vertices and k up to k_max. */
+  void init_binomial_coefficients(int k_max) {
+    num_binomial_columns_ = k_max + 1;
+    binomial_coefficients_.assign((num_vertices_ + 1) * num_binomial_columns_, 0);
+    for (Simplex_index n = 0; n <= num_vertices_; ++n) {
+      binomial_coefficients_[n * num_binomial_columns_] = 1;
+      for (int k = 1; k <= std::min<Simplex_index>(n, k_max); ++k) {
+        Simplex_index above = binomial(n - 1, k - 1);
+        Simplex_index left = binomial(n - 1, k);
+        if (above > std::numeric_limits<Simplex_index>::max() - left)
+          throw std::overflow_error("Rips_persistence::compute_persistence - simplex indices do not fit on 64 bits");
+        binomial_coefficients_[n * num_binomial_columns_ + k] = above + left;
+      }
+    }
+  }
+
+  Simplex_index binomial(Simplex_index n, int k) const {
+    return binomial_coefficients_[n * num_binomial_columns_ + k];
+  }
+
+  void init_multiplicative_inverses() {
+    inverses_.assign(modulus_, 0);
+    if (modulus_ > 1) inverses_[1] = 1;
+    // a * (m / a) + m % a = m, hence a^{-1} = -(m / a) * (m % a)^{-1} in Z/mZ
+    for (Coefficient a = 2; a < modulus_; ++a)
+      inverses_[a] = modulus_ - (inverses_[modulus_ % a] * (modulus_ / a)) % modulus_;
+  }
+
+  /** \brief Returns the largest vertex v <= v_max such that C(v, k) <= idx. */
+  Vertex_handle max_vertex(Simplex_index idx, int k, Vertex_handle v_max) const {
+    Vertex_handle lo = k - 1, hi = v_max;
+    while (lo < hi) {
+      Vertex_handle mid = hi - (hi - lo) / 2;
+      if (binomial(mid, k) <= idx) lo = mid; else hi = mid - 1;
+    }
+    return lo;
+  }
+
+  /** \brief Fills vertices with the vertices of the simplex of dimension dim and index idx, in decreasing order. */
+  void simplex_vertices(Simplex_index idx, int dim, std::vector<Vertex_handle>& vertices) const {
+    vertices.clear();
+    Vertex_handle v = num_vertices_ - 1;
+    for (int k = dim + 1; k > 0; --k) {
+      v = max_vertex(idx, k, v);
+      vertices.push_back(v);
+      idx -= binomial(v, k);
+    }
+  }
+
+  /** \brief Enumerates the cofacets of a simplex, by decreasing index.
+   *
+   * The vertices added to the simplex are the common neighbors of its vertices. If all_cofacets is false, only the
+   * cofacets obtained by adding a vertex greater than all the vertices of the simplex are enumerated, which
+   * enumerates every simplex of the next dimension exactly once.
+   * The enumeration stops if f returns false. */
+  template<typename Function>
+  void for_each_cofacet(const Simplex_entry& simplex, int dim, bool all_cofacets, Function&& f) {
+    std::vector<Vertex_handle>& vertices = vertices_buffer_;
+    simplex_vertices(simplex.index_, dim, vertices);
+    // The candidates are the neighbors of the vertex with the fewest neighbors.
+    std::size_t shortest = 0;
+    for (std::size_t i = 1; i < vertices.size(); ++i) {
+      if (neighbors_[vertices[i]].size() < neighbors_[vertices[shortest]].size()) shortest = i;
+    }
+    neighbor_iterators_.clear();
+    for (Vertex_handle u : vertices) neighbor_iterators_.push_back(neighbors_[u].begin());
+
+    Simplex_index idx_below = simplex.index_;
+    Simplex_index idx_above = 0;
+    int k = dim + 1;
+    for (const Neighbor& candidate : neighbors_[vertices[shortest]]) {
+      Vertex_handle v = candidate.first;
+      if (!all_cofacets && v < vertices[0]) return;
+      Filtration_value filtration = std::max(simplex.filtration_, candidate.second);
+      bool is_common_neighbor = true;
+      for (std::size_t i = 0; i < vertices.size() && is_common_neighbor; ++i) {
+        if (i == shortest) continue;
+        auto& it = neighbor_iterators_[i];
+        auto end = neighbors_[vertices[i]].end();
+        while (it != end && it->first > v) ++it;
+        if (it == end || it->first != v)
+          is_common_neighbor = false;
+        else
+          filtration = std::max(filtration, it->second);
+      }
+      if (!is_common_neighbor) continue;
+      // The vertices of the simplex greater than v have one more vertex below them in the cofacet.
+      while (k > 0 && vertices[dim + 1 - k] > v) {
+        idx_below -= binomial(vertices[dim + 1 - k], k);
+        idx_above += binomial(vertices[dim + 1 - k], k + 1);
+        --k;
+      }
+      Coefficient coefficient = (k & 1) ? (modulus_ - simplex.coefficient_) % modulus_ : simplex.coefficient_;
+      if (!f(Simplex_entry(filtration, idx_above + binomial(v, k + 1) + idx_below, coefficient))) return;
+    }
+  }
+
+  /** \brief Returns true if one of the simplices of dimension dim has a cofacet. */
+  bool has_cofacet(const std::vector<Simplex_entry>& simplices, int dim) {
+    bool found = false;
+    for (const Simplex_entry& simplex : simplices) {
+      for_each_cofacet(simplex, dim, false, [&found](const Simplex_entry&) {
+        found = true;
+        return false;
+      });
+      if (found) return true;
+    }
+    return false;
+  }
+
+  /** \brief Pops the entries with the smallest index in the filtration order, and returns their sum.
+   * Returns an entry of coefficient 0 if the column is zero. */
+  Simplex_entry pop_pivot(Working_column& column) const {
+    Simplex_entry pivot(0, -1, 0);
+    while (!column.empty()) {
+      if (pivot.coefficient_ == 0) {
+        pivot = column.top();
+      } else if (column.top().index_ != pivot.index_) {
+        return pivot;
+      } else {
+        pivot.coefficient_ = (pivot.coefficient_ + column.top().coefficient_) % modulus_;
+      }
+      column.pop();
+    }
+    return pivot;
+  }
+
+  Simplex_entry get_pivot(Working_column& column) const {
+    Simplex_entry pivot = pop_pivot(column);
+    if (pivot.coefficient_ != 0) column.push(pivot);
+    return pivot;
+  }
+
+  void record_interval(int dim, Filtration_value birth, Filtration_value death) {
+    if (death - birth > min_interval_length_) intervals_[dim].emplace_back(birth, death);
+  }
+
+  /** \brief Computes the 0-dimensional persistence with a union-find on the edges, and the edges which are the
+   * columns to reduce in dimension 1. */
+  void compute_dim_0_pairs(std::vector<Simplex_entry>& simplices, std::vector<Simplex_entry>& columns_to_reduce,
+                           int dim_max) {
+    simplices.clear();
+    for (Vertex_handle u = 1; u < num_vertices_; ++u) {
+      for (const Neighbor& v : neighbors_[u]) {
+        if (v.first < u) simplices.emplace_back(v.second, binomial(u, 2) + v.first, 1);
+      }
+    }
+    // Edges in the filtration order.
+    std::sort(simplices.rbegin(), simplices.rend(), Is_after_in_filtration());
+
+    std::vector<Vertex_handle> parent(num_vertices_);
+    for (Vertex_handle v = 0; v < num_vertices_; ++v) parent[v] = v;
+    auto find = [&parent](Vertex_handle v) {
+      while (parent[v] != v) {
+        parent[v] = parent[parent[v]];
+        v = parent[v];
+      }
+      return v;
+    };
+
+    columns_to_reduce.clear();
+    std::vector<Vertex_handle> vertices;
+    for (const Simplex_entry& edge : simplices) {
+      simplex_vertices(edge.index_, 1, vertices);
+      Vertex_handle u = find(vertices[0]);
+      Vertex_handle v = find(vertices[1]);
+      if (u != v) {
+        // All the vertices are born at 0, the younger component is killed.
+        record_interval(0, 0, edge.filtration_);
+        if (u < v) std::swap(u, v);
+        parent[u] = v;
+      } else if (dim_max > 1) {
+        columns_to_reduce.push_back(edge);
+      }
+    }
+    for (Vertex_handle v = 0; v < num_vertices_; ++v) {
+      if (find(v) == v) record_interval(0, 0, std::numeric_limits<Filtration_value>::infinity());
+    }
+    // Columns are reduced in reverse filtration order.
+    std::reverse(columns_to_reduce.begin(), columns_to_reduce.end());
+  }
+
+  /** \brief Computes the simplices of dimension dim from the ones of dimension dim - 1, and the columns to reduce,
+   * which are the simplices that are not the pivot of a reduced column of dimension dim - 1. */
+  void assemble_columns_to_reduce(std::vector<Simplex_entry>& simplices, std::vector<Simplex_entry>& columns_to_reduce,
+                                  const Pivot_map& pivot_column_index, int dim) {
+    std::vector<Simplex_entry> next_simplices;
+    columns_to_reduce.clear();
+    for (const Simplex_entry& simplex : simplices) {
+      for_each_cofacet(simplex, dim - 1, false, [&](const Simplex_entry& cofacet) {
+        next_simplices.emplace_back(cofacet.filtration_, cofacet.index_, 1);
+        if (pivot_column_index.find(cofacet.index_) == pivot_column_index.end())
+          columns_to_reduce.emplace_back(cofacet.filtration_, cofacet.index_, 1);
+        return true;
+      });
+    }
+    simplices.swap(next_simplices);
+    std::sort(columns_to_reduce.begin(), columns_to_reduce.end(), Is_after_in_filtration());
+  }
+
+  /** \brief Pushes simplex in working_reduction_column and its coboundary in working_coboundary. */
+  void add_simplex_coboundary(const Simplex_entry& simplex, int dim, Working_column& working_reduction_column,
+                              Working_column& working_coboundary) {
+    working_reduction_column.push(simplex);
+    for_each_cofacet(simplex, dim, true, [&](const Simplex_entry& cofacet) {
+      working_coboundary.push(cofacet);
+      return true;
+    });
+  }
+
+  /** \brief Reduces the coboundary matrix of dimension dim, and records the intervals of dimension dim. */
+  void compute_pairs(const std::vector<Simplex_entry>& columns_to_reduce, Pivot_map& pivot_column_index, int dim) {
+    // Coefficients of the reduction, i.e. the columns added to each column, stored one after the other.
+    std::vector<Simplex_entry> reduction_entries;
+    std::vector<std::size_t> reduction_offsets(1, 0);
+    std::vector<Simplex_entry> cofacets;
+    for (std::size_t idx_col = 0; idx_col < columns_to_reduce.size(); ++idx_col) {
+      const Simplex_entry& column_to_reduce = columns_to_reduce[idx_col];
+      Working_column working_reduction_column, working_coboundary;
+
+      // Look for an apparent pair while enumerating the coboundary: the cofacets are enumerated by decreasing
+      // index, the first one of same filtration value is the pivot.
+      Simplex_entry pivot(0, -1, 0);
+      bool check_for_apparent_pair = true;
+      cofacets.clear();
+      for_each_cofacet(column_to_reduce, dim, true, [&](const Simplex_entry& cofacet) {
+        cofacets.push_back(cofacet);
+        if (check_for_apparent_pair && cofacet.filtration_ == column_to_reduce.filtration_) {
+          if (pivot_column_index.find(cofacet.index_) == pivot_column_index.end()) {
+            pivot = cofacet;
+            return false;
+          }
+          check_for_apparent_pair = false;
+        }
+        return true;
+      });
+      if (pivot.coefficient_ == 0) {
+        for (const Simplex_entry& cofacet : cofacets) working_coboundary.push(cofacet);
+        pivot = get_pivot(working_coboundary);
+      }
+
+      while (true) {
+        if (pivot.coefficient_ == 0) {
+          if (dim < static_cast<int>(intervals_.size()))
+            record_interval(dim, column_to_reduce.filtration_, std::numeric_limits<Filtration_value>::infinity());
+          break;
+        }
+        auto pair = pivot_column_index.find(pivot.index_);
+        if (pair == pivot_column_index.end()) {
+          record_interval(dim, column_to_reduce.filtration_, pivot.filtration_);
+          pivot_column_index.emplace(pivot.index_, std::make_pair(idx_col, pivot.coefficient_));
+          break;
+        }
+        // Add the column whose pivot is the same, with its reduction.
+        std::size_t idx_other = pair->second.first;
+        Coefficient factor = modulus_ - (pivot.coefficient_ * inverses_[pair->second.second]) % modulus_;
+        Simplex_entry column_to_add = columns_to_reduce[idx_other];
+        column_to_add.coefficient_ = factor;
+        add_simplex_coboundary(column_to_add, dim, working_reduction_column, working_coboundary);
+        for (std::size_t i = reduction_offsets[idx_other]; i < reduction_offsets[idx_other + 1]; ++i) {
+          Simplex_entry simplex = reduction_entries[i];
+          simplex.coefficient_ = (simplex.coefficient_ * factor) % modulus_;
+          add_simplex_coboundary(simplex, dim, working_reduction_column, working_coboundary);
+        }
+        pivot = get_pivot(working_coboundary);
+      }
+      // Store the reduction of the column.
+      for (Simplex_entry e = pop_pivot(working_reduction_column); e.coefficient_ != 0;
+           e = pop_pivot(working_reduction_column)) {
+        reduction_entries.push_back(e);
+      }
+      reduction_offsets.push_back(reduction_entries.size());
+    }
+  }
+
+ private:
+  Filtration_value threshold_;
+  Vertex_handle num_vertices_;
+  // For each vertex, its neighbors with the length of the edge, by decreasing vertex.
+  std::vector<std::vector<Neighbor>> neighbors_;
+  // Binomial coefficients C(n, k), in a (num_vertices_ + 1) x num_binomial_columns_ array.
+  std::vector<Simplex_index> binomial_coefficients_;
+  int num_binomial_columns_;
+  Coefficient modulus_;
+  std::vector<Coefficient> inverses_;
+  Filtration_value min_interval_length_;
+  // Vertices of the simplex whose cofacets are enumerated.
+  std::vector<Vertex_handle> vertices_buffer_;
+  std::vector<typename std::vector<Neighbor>::const_iterator> neighbor_iterators_;
+  // Persistence intervals, by dimension.
+  std::vector<std::vector<Persistence_interval>> intervals_;
+};
+
+}  // namespace rips_complex
+
+}  // namespace Gudhi
+
+#endif  // RIPS_PERSISTENCE_H_
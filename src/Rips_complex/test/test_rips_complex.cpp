@@ -17,9 +17,12 @@
 #include <string>
 #include <vector>
 #include <algorithm>    // std::max
+#include <cstdlib>  // for std::rand
 
 #include <gudhi/Rips_complex.h>
 #include <gudhi/Sparse_rips_complex.h>
+#include <gudhi/Rips_persistence.h>
+#include <gudhi/Persistent_cohomology.h>
 // to construct Rips_complex from a OFF file of points
 #include <gudhi/Points_off_io.h>
 #include <gudhi/Simplex_tree.h>
@@ -34,6 +37,9 @@ using Filtration_value = Simplex_tree::Filtration_value;
 using Rips_complex = Gudhi::rips_complex::Rips_complex<Simplex_tree::Filtration_value>;
 using Sparse_rips_complex = Gudhi::rips_complex::Sparse_rips_complex<Simplex_tree::Filtration_value>;
 using Distance_matrix = std::vector<std::vector<Filtration_value>>;
+using Rips_persistence = Gudhi::rips_complex::Rips_persistence<Simplex_tree::Filtration_value>;
+using Field_Zp = Gudhi::persistent_cohomology::Field_Zp;
+using Persistent_cohomology = Gudhi::persistent_cohomology::Persistent_cohomology<Simplex_tree, Field_Zp>;
 
 BOOST_AUTO_TEST_CASE(RIPS_DOC_OFF_file) {
   // ----------------------------------------------------------------------------
@@ -380,6 +386,117 @@ BOOST_AUTO_TEST_CASE(Rips_doc_csv_file) {
 
 }
 
+// Checks that Rips_persistence gives the same intervals as the persistent cohomology of the Rips complex
+void test_rips_persistence(Rips_complex& rips_complex, Rips_persistence& rips_persistence, int dim_max,
+                           int coefficient, Filtration_value min_persistence) {
+  Simplex_tree stree;
+  rips_complex.create_complex(stree, dim_max);
+  Persistent_cohomology pcoh(stree);
+  pcoh.init_coefficients(coefficient);
+  pcoh.compute_persistent_cohomology(min_persistence);
+
+  rips_persistence.compute_persistence(dim_max, coefficient, min_persistence);
+  for (int dim = 0; dim < dim_max + 1; dim++) {
+    auto expected = pcoh.intervals_in_dimension(dim);
+    auto intervals = rips_persistence.intervals_in_dimension(dim);
+    std::sort(expected.begin(), expected.end());
+    std::sort(intervals.begin(), intervals.end());
+    std::clog << "Dimension " << dim << " - " << intervals.size() << " intervals" << std::endl;
+    BOOST_CHECK(intervals == expected);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Rips_persistence_from_points_and_distance_matrix) {
+  std::srand(42);
+  std::vector<Point> points;
+  for (int i = 0; i < 40; i++)
+    points.push_back({static_cast<double>(std::rand() % 1000) / 1000., static_cast<double>(std::rand() % 1000) / 1000.,
+                      static_cast<double>(std::rand() % 1000) / 1000.});
+  Distance_matrix distances;
+  for (std::size_t i = 0; i < points.size(); i++) {
+    distances.emplace_back();
+    for (std::size_t j = 0; j < i; j++) distances.back().push_back(Gudhi::Euclidean_distance()(points[i], points[j]));
+  }
+
+  for (double threshold : {0.3, 0.5, std::numeric_limits<double>::infinity()}) {
+    std::clog << "========== Rips_persistence - threshold = " << threshold << " ==========" << std::endl;
+    Rips_complex rips_complex_from_points(points, threshold, Gudhi::Euclidean_distance());
+    Rips_persistence rips_persistence_from_points(points, threshold, Gudhi::Euclidean_distance());
+    test_rips_persistence(rips_complex_from_points, rips_persistence_from_points, 3, 2, 0.);
+    test_rips_persistence(rips_complex_from_points, rips_persistence_from_points, 4, 3, 0.05);
+
+    Rips_complex rips_complex_from_matrix(distances, threshold);
+    Rips_persistence rips_persistence_from_matrix(distances, threshold);
+    test_rips_persistence(rips_complex_from_matrix, rips_persistence_from_matrix, 3, 11, 0.);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Rips_persistence_below_dim_max) {
+  // A square and a point far away: at threshold 1, the Rips complex is a cycle of dimension 1, and at threshold 0.5
+  // it is made of vertices.
+  std::vector<Point> points = {{0., 0.}, {1., 0.}, {1., 1.}, {0., 1.}, {5., 5.}};
+  for (double threshold : {0.5, 1., 1.5}) {
+    std::clog << "========== Rips_persistence - square - threshold = " << threshold << " ==========" << std::endl;
+    Rips_complex rips_complex(points, threshold, Gudhi::Euclidean_distance());
+    Rips_persistence rips_persistence(points, threshold, Gudhi::Euclidean_distance());
+    test_rips_persistence(rips_complex, rips_persistence, 3, 2, 0.);
+  }
+
+  Rips_persistence rips_persistence(points, 1., Gudhi::Euclidean_distance());
+  rips_persistence.compute_persistence(3);
+  // The cycle is not filled, but there is no interval in the dimension of the complex.
+  BOOST_CHECK(rips_persistence.intervals_in_dimension(0).size() == 5);
+  BOOST_CHECK(rips_persistence.intervals_in_dimension(1).empty());
+  BOOST_CHECK(rips_persistence.intervals_in_dimension(2).empty());
+}
+
+BOOST_AUTO_TEST_CASE(Rips_complex_euclidean_proximity_graph) {
+  // Same computation as Gudhi::Euclidean_distance, but not recognized as the Euclidean distance
+  auto euclidean_distance = [](const Point& p1, const Point& p2) { return Gudhi::Euclidean_distance()(p1, p2); };
+  std::srand(42);
+  std::vector<Point> points;
+  for (int i = 0; i < 100; i++)
+    points.push_back({static_cast<double>(std::rand() % 100) / 100., static_cast<double>(std::rand() % 100) / 100.,
+                      static_cast<double>(std::rand() % 100) / 100., static_cast<double>(std::rand() % 100) / 100.});
+  // Duplicated points and points at distance exactly the threshold
+  points.push_back(points[0]);
+  points.push_back({points[1][0], points[1][1], points[1][2], points[1][3] + 0.25});
+
+  for (double threshold : {0., 0.25, 0.5, std::numeric_limits<double>::infinity()}) {
+    std::clog << "========== Euclidean proximity graph - threshold = " << threshold << " ==========" << std::endl;
+    std::vector<std::pair<int, int>> edges, expected_edges;
+    std::vector<double> edges_fil, expected_edges_fil;
+    BOOST_CHECK(Gudhi::compute_proximity_edges(points, threshold, Gudhi::Euclidean_distance(), edges, edges_fil) ==
+                static_cast<int>(points.size()));
+    Gudhi::compute_proximity_edges(points, threshold, euclidean_distance, expected_edges, expected_edges_fil);
+    BOOST_CHECK(edges == expected_edges);
+    BOOST_CHECK(edges_fil == expected_edges_fil);
+
+    Rips_complex rips_complex(points, threshold, Gudhi::Euclidean_distance());
+    Rips_complex expected_rips_complex(points, threshold, euclidean_distance);
+    Simplex_tree stree, expected_stree;
+    rips_complex.create_complex(stree, 2);
+    expected_rips_complex.create_complex(expected_stree, 2);
+    BOOST_CHECK(stree == expected_stree);
+
+    // The distances are rounded to float before the comparison with the threshold
+    using Float_rips_complex = Gudhi::rips_complex::Rips_complex<float>;
+    Gudhi::Simplex_tree<Gudhi::Simplex_tree_options_fast_persistence> float_stree, expected_float_stree;
+    Float_rips_complex(points, threshold, Gudhi::Euclidean_distance()).create_complex(float_stree, 2);
+    Float_rips_complex(points, threshold, euclidean_distance).create_complex(expected_float_stree, 2);
+    BOOST_CHECK(float_stree == expected_float_stree);
+  }
+
+  // Degenerate point clouds
+  std::vector<std::pair<int, int>> edges;
+  std::vector<double> edges_fil;
+  BOOST_CHECK(Gudhi::compute_proximity_edges(std::vector<Point>(), 1., Gudhi::Euclidean_distance(), edges,
+                                             edges_fil) == 0);
+  BOOST_CHECK(Gudhi::compute_proximity_edges(std::vector<Point>(3), 1., Gudhi::Euclidean_distance(), edges,
+                                             edges_fil) == 3);
+  BOOST_CHECK(edges.size() == 3);
+}
+
 #ifdef GUDHI_DEBUG
 BOOST_AUTO_TEST_CASE(Rips_create_complex_throw) {
   // ----------------------------------------------------------------------------
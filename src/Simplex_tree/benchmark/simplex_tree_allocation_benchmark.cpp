@@ -0,0 +1,81 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Clément Maria
+ *
+ *    Copyright (C) 2020 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#include <gudhi/Simplex_tree.h>
+#include <gudhi/Rips_complex.h>
+#include <gudhi/Points_off_io.h>
+#include <gudhi/distance_functions.h>
+#include <gudhi/Clock.h>
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cstdlib>  // for std::atof
+
+using Point = std::vector<double>;
+
+struct Simplex_tree_options_arena : Gudhi::Simplex_tree_options_full_featured {
+  static const bool arena_allocation = true;
+};
+
+// Peak resident set size of the process in kB, as reported by Linux, or -1.
+long peak_rss_kb() {
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line)) {
+    if (line.compare(0, 6, "VmHWM:") == 0) return std::atol(line.c_str() + 6);
+  }
+  return -1;
+}
+
+template<typename Simplex_tree>
+void benchmark(const std::vector<Point>& points, double threshold, int dim_max) {
+  Gudhi::rips_complex::Rips_complex<double> rips_complex(points, threshold, Gudhi::Euclidean_distance());
+  Simplex_tree* stree = new Simplex_tree();
+  Gudhi::Clock construction("  Construction");
+  rips_complex.create_complex(*stree, dim_max);
+  construction.end();
+  std::clog << "  " << stree->num_simplices() << " simplices" << std::endl;
+  std::clog << construction;
+  Gudhi::Clock destruction("  Destruction");
+  delete stree;
+  destruction.end();
+  std::clog << destruction;
+}
+
+/*
+ * Compares the construction and destruction times and the peak memory of a Rips complex in a Simplex_tree, with the
+ * siblings allocated on the heap or in an arena. As the peak memory is the one of the process, run it once per
+ * allocation mode.
+ * Usage: simplex_tree_allocation_benchmark [heap|arena] [off_file threshold dim_max]
+ */
+int main(int argc, char * argv[]) {
+  std::string mode = "heap";
+  std::string off_file_points = "Kl.off";
+  double threshold = 0.27;
+  int dim_max = 3;
+  if (argc >= 2) mode = argv[1];
+  if (argc == 5) {
+    off_file_points = argv[2];
+    threshold = std::atof(argv[3]);
+    dim_max = std::atoi(argv[4]);
+  }
+
+  Gudhi::Points_off_reader<Point> off_reader(off_file_points);
+  std::clog << "Rips complex of " << off_file_points << " - threshold " << threshold << " - dimension " << dim_max
+      << " - siblings allocated in the " << mode << std::endl;
+  if (mode == "arena")
+    benchmark<Gudhi::Simplex_tree<Simplex_tree_options_arena>>(off_reader.get_point_cloud(), threshold, dim_max);
+  else
+    benchmark<Gudhi::Simplex_tree<>>(off_reader.get_point_cloud(), threshold, dim_max);
+  std::clog << "  Peak resident set size: " << peak_rss_kb() << " kB" << std::endl;
+  return 0;
+}
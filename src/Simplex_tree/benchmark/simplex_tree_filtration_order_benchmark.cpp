@@ -0,0 +1,74 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Clément Maria
+ *
+ *    Copyright (C) 2020 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#include <gudhi/Simplex_tree.h>
+#include <gudhi/Rips_complex.h>
+#include <gudhi/Persistent_cohomology.h>
+#include <gudhi/Points_off_io.h>
+#include <gudhi/distance_functions.h>
+#include <gudhi/Clock.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdlib>  // for std::atof
+#include <cstddef>  // for std::size_t
+
+using Point = std::vector<double>;
+using Simplex_tree = Gudhi::Simplex_tree<Gudhi::Simplex_tree_options_fast_persistence>;
+using Persistent_cohomology =
+    Gudhi::persistent_cohomology::Persistent_cohomology<Simplex_tree, Gudhi::persistent_cohomology::Field_Zp>;
+
+// Number of finite intervals of positive length, to check that the orders give the same diagrams.
+std::size_t num_intervals(Simplex_tree& stree) {
+  Persistent_cohomology pcoh(stree);
+  pcoh.init_coefficients(2);
+  pcoh.compute_persistent_cohomology();
+  return pcoh.get_persistent_pairs().size();
+}
+
+/*
+ * Compares the time to order the simplices of a Rips complex by filtration with initialize_filtration() and with
+ * initialize_filtration_by_dimension().
+ * Usage: simplex_tree_filtration_order_benchmark [off_file threshold dim_max]
+ */
+int main(int argc, char * argv[]) {
+  std::string off_file_points = "Kl.off";
+  double threshold = 0.27;
+  int dim_max = 3;
+  if (argc == 4) {
+    off_file_points = argv[1];
+    threshold = std::atof(argv[2]);
+    dim_max = std::atoi(argv[3]);
+  }
+
+  Gudhi::Points_off_reader<Point> off_reader(off_file_points);
+  Gudhi::rips_complex::Rips_complex<Simplex_tree::Filtration_value> rips_complex(off_reader.get_point_cloud(),
+                                                                                  threshold,
+                                                                                  Gudhi::Euclidean_distance());
+  Simplex_tree stree;
+  rips_complex.create_complex(stree, dim_max);
+  std::clog << "Rips complex of " << off_file_points << " - threshold " << threshold << " - dimension " << dim_max
+      << " - " << stree.num_simplices() << " simplices" << std::endl;
+
+  Gudhi::Clock comparison_sort("  initialize_filtration()");
+  stree.initialize_filtration();
+  comparison_sort.end();
+  std::clog << comparison_sort;
+  std::size_t intervals = num_intervals(stree);
+
+  Gudhi::Clock radix_sort("  initialize_filtration_by_dimension()");
+  stree.initialize_filtration_by_dimension();
+  radix_sort.end();
+  std::clog << radix_sort;
+  if (num_intervals(stree) != intervals) std::cerr << "  Different persistence diagrams" << std::endl;
+
+  return 0;
+}
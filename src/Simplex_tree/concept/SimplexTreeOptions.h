@@ -27,5 +27,9 @@ struct SimplexTreeOptions {
   static const bool store_filtration;
   /// If true, the list of vertices present in the complex must always be 0, ..., num_vertices-1, without any hole.
   static constexpr bool contiguous_vertices;
+  /// If true, the nodes of the tree are allocated in an arena owned by the `Simplex_tree`, that is released at once
+  /// when the tree is cleared or destroyed. The memory of removed simplices is only reclaimed at this time. Optional,
+  /// false if not defined.
+  static const bool arena_allocation;
 };
 
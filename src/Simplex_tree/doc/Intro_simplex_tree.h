@@ -35,6 +35,10 @@ namespace Gudhi {
  * efficient and flexible data structure for representing general (filtered) simplicial complexes. The data structure
  * is described in \cite boissonnatmariasimplextreealgorithmica
  * \image html "Simplex_tree_representation.png" "Simplex tree representation"
+ *
+ * The simplices are sorted by filtration value with `Simplex_tree::initialize_filtration()`, which breaks ties with the
+ * reverse lexicographic order, or with `Simplex_tree::initialize_filtration_by_dimension()`, which breaks ties by
+ * dimension and replaces the comparison sort by a radix sort, much faster on large complexes.
  * 
  * \subsubsection filteredcomplexessimplextreeexamples Examples
  * 
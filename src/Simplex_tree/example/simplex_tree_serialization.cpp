@@ -0,0 +1,67 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Clément Maria
+ *
+ *    Copyright (C) 2020 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#include <gudhi/Simplex_tree.h>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <cstdlib>  // for EXIT_FAILURE
+
+using Simplex_tree = Gudhi::Simplex_tree<>;
+namespace bip = boost::interprocess;
+
+int main(int argc, char* const argv[]) {
+  if (argc != 3) {
+    std::cerr << "Usage: " << argv[0]
+        << " path_to_input_file.fsc path_to_output_file.bin \n"
+        << "  Reads a filtered simplicial complex, serializes it in a binary file, and loads it back by memory "
+        << "mapping.\n";
+    exit(-1);  // ----- >>
+  }
+
+  Simplex_tree stree;
+  std::ifstream simplex_tree_stream(argv[1]);
+  simplex_tree_stream >> stree;
+  std::clog << "The complex contains " << stree.num_simplices() << " simplices - dimension " << stree.dimension()
+      << std::endl;
+
+  // Write the serialization directly in a memory mapped file of the right size
+  std::size_t buffer_size = stree.get_serialization_size();
+  {
+    std::filebuf output;
+    output.open(argv[2], std::ios_base::in | std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+    output.pubseekoff(buffer_size - 1, std::ios_base::beg);
+    output.sputc(0);
+  }
+  {
+    bip::file_mapping output_mapping(argv[2], bip::read_write);
+    bip::mapped_region output_region(output_mapping, bip::read_write);
+    stree.serialize(static_cast<char*>(output_region.get_address()), output_region.get_size());
+  }
+  std::clog << "Serialization of " << buffer_size << " bytes written in " << argv[2] << std::endl;
+
+  // Load the Simplex_tree from the memory mapped file
+  bip::file_mapping input_mapping(argv[2], bip::read_only);
+  bip::mapped_region input_region(input_mapping, bip::read_only);
+  Simplex_tree stree_from_file;
+  stree_from_file.deserialize(static_cast<const char*>(input_region.get_address()), input_region.get_size());
+  std::clog << "The loaded complex contains " << stree_from_file.num_simplices() << " simplices - dimension "
+      << stree_from_file.dimension() << std::endl;
+
+  if (!(stree == stree_from_file)) {
+    std::cerr << "The loaded complex differs from the serialized one." << std::endl;
+    return EXIT_FAILURE;
+  }
+  return 0;
+}
@@ -15,10 +15,14 @@
 #include <gudhi/Simplex_tree/Simplex_tree_siblings.h>
 #include <gudhi/Simplex_tree/Simplex_tree_iterators.h>
 #include <gudhi/Simplex_tree/indexing_tag.h>
+#include <gudhi/Simplex_tree/Simplex_tree_arena.h>
+#include <gudhi/Simplex_tree/Simplex_tree_radix_sort.h>
+#include <gudhi/Simplex_tree/serialization_utils.h>
 
 #include <gudhi/reader_utils.h>
 #include <gudhi/graph_simplicial_complex.h>
 #include <gudhi/Debug_utils.h>
+#include <gudhi/Instrumentation.h>
 
 #include <boost/container/flat_map.hpp>
 #include <boost/iterator/transform_iterator.hpp>
@@ -28,10 +32,14 @@
 
 #ifdef GUDHI_USE_TBB
 #include <tbb/parallel_sort.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/blocked_range.h>
 #endif
 
 #include <utility>
 #include <vector>
+#include <tuple>  // for std::get
 #include <functional>  // for greater<>
 #include <stdexcept>
 #include <limits>  // Inf
@@ -39,6 +47,9 @@
 #include <algorithm>  // for std::max
 #include <cstdint>  // for std::uint32_t
 #include <iterator>  // for std::distance
+#include <cstddef>  // for std::size_t, std::ptrdiff_t
+#include <memory>  // for std::unique_ptr
+#include <type_traits>  // for std::integral_constant
 
 namespace Gudhi {
 
@@ -95,7 +106,11 @@ class Simplex_tree {
   // Note: this wastes space when Vertex_handle is 32 bits and Node is aligned on 64 bits. It would be better to use a
   // flat_set (with our own comparator) where we can control the layout of the struct (put Vertex_handle and
   // Simplex_key next to each other).
-  typedef typename boost::container::flat_map<Vertex_handle, Node> Dictionary;
+  typedef typename std::conditional<Simplex_tree_arena_allocation<Options>::value,
+                                    boost::container::flat_map<Vertex_handle, Node, std::less<Vertex_handle>,
+                                                               Simplex_tree_arena_allocator<std::pair<Vertex_handle,
+                                                                                                      Node>>>,
+                                    boost::container::flat_map<Vertex_handle, Node>>::type Dictionary;
 
   /* \brief Set of nodes sharing a same parent in the simplex tree. */
   /* \brief Set of nodes sharing a same parent in the simplex tree. */
@@ -307,6 +322,68 @@ class Simplex_tree {
       filtration_vect_(),
       dimension_(-1) { }
 
+  /** \brief Constructs the simplex tree of a list of simplices sorted in lexicographical order, in linear time.
+   *
+   * Every simplex is appended to the members of its parent, without any search, so the simplices must be given in
+   * the order of a depth-first traversal of the tree, which is the lexicographical order of their sorted vertices.
+   *
+   * @param[in] simplices Range of pairs (or tuples) of a range of vertices, sorted by increasing `Vertex_handle`,
+   * and a filtration value. It must contain every face of its simplices, and be sorted in lexicographical order
+   * without duplicates, for instance `{{{0}, 0.}, {{0, 1}, 1.}, {{0, 1, 2}, 2.}, {{0, 2}, 1.}, {{1}, 0.}, ...}`.
+   * \exception std::invalid_argument In debug mode, if the simplices are not sorted or a face is missing. All the faces
+   * are checked, with one more traversal of the tree that searches the facets of every simplex.
+   */
+  template <typename SortedSimplexRange>
+  Simplex_tree(boost::container::ordered_unique_range_t, const SortedSimplexRange& simplices) : Simplex_tree() {
+    // Siblings being filled at each depth: the ones at depth d + 1 are the children of the last member of the ones
+    // at depth d.
+    std::vector<Siblings*> path(1, &root_);
+    for (auto&& simplex_and_filtration : simplices) {
+      auto&& simplex = std::get<0>(simplex_and_filtration);
+      std::size_t depth = 0;
+      Vertex_handle vertex = null_vertex_;
+      for (auto v : simplex) {
+        if (depth++ != 0) {
+          GUDHI_CHECK(depth - 1 <= path.size() && !path[depth - 2]->members().empty() &&
+                      path[depth - 2]->members().rbegin()->first == vertex,
+                      std::invalid_argument("Simplex_tree - a face of a simplex is missing or comes after it"));
+        }
+        vertex = v;
+      }
+      GUDHI_CHECK(depth != 0, std::invalid_argument("Simplex_tree - empty simplex"));
+      if (depth > path.size()) {
+        GUDHI_CHECK(depth == path.size() + 1, std::invalid_argument("Simplex_tree - a face of a simplex is missing"));
+        Siblings* parent = path.back();
+        auto parent_sh = std::prev(parent->members().end());
+        GUDHI_CHECK(!has_children(parent_sh), std::invalid_argument("Simplex_tree - simplices are not sorted"));
+        Siblings* sib = new_siblings(parent, parent_sh->first);
+        parent_sh->second.assign_children(sib);
+        path.push_back(sib);
+      } else {
+        path.resize(depth);
+      }
+      Siblings* sib = path.back();
+      GUDHI_CHECK(sib->members().empty() || sib->members().rbegin()->first < vertex,
+                  std::invalid_argument("Simplex_tree - simplices are not sorted"));
+      sib->members_.emplace_hint(sib->members_.end(), vertex, Node(sib, std::get<1>(simplex_and_filtration)));
+      if (static_cast<int>(depth) - 1 > dimension_) dimension_ = static_cast<int>(depth) - 1;
+    }
+#ifdef GUDHI_DEBUG
+    // Only the prefixes of a simplex come before it in lexicographical order, its other facets are checked once the
+    // tree is built.
+    for (auto sh : complex_simplex_range()) {
+      auto vertices = simplex_vertex_range(sh);
+      std::vector<Vertex_handle> simplex(vertices.begin(), vertices.end());
+      for (std::size_t i = 0; simplex.size() > 1 && i < simplex.size(); ++i) {
+        std::vector<Vertex_handle> facet(simplex);
+        facet.erase(facet.begin() + i);
+        GUDHI_CHECK(find(facet) != null_simplex(),
+                    std::invalid_argument("Simplex_tree - a face of a simplex is missing"));
+      }
+    }
+#endif  // GUDHI_DEBUG
+  }
+
   /** \brief User-defined copy constructor reproduces the whole tree structure. */
   Simplex_tree(const Simplex_tree& complex_source) {
 #ifdef DEBUG_TRACES
@@ -389,7 +466,7 @@ class Simplex_tree {
     for (auto sh = sib->members().begin(), sh_source = sib_source->members().begin();
          sh != sib->members().end(); ++sh, ++sh_source) {
       if (has_children(sh_source)) {
-        Siblings * newsib = new Siblings(sib, sh_source->first);
+        Siblings * newsib = new_siblings(sib, sh_source->first);
         newsib->members_.reserve(sh_source->second.children()->members().size());
         for (auto & child : sh_source->second.children()->members())
           newsib->members_.emplace_hint(newsib->members_.end(), child.first, Node(newsib, child.second.filtration()));
@@ -403,6 +480,7 @@ class Simplex_tree {
   void move_from(Simplex_tree& complex_source) {
     null_vertex_ = std::move(complex_source.null_vertex_);
     root_ = std::move(complex_source.root_);
+    arena_ = std::move(complex_source.arena_);
     filtration_vect_ = std::move(complex_source.filtration_vect_);
     dimension_ = std::move(complex_source.dimension_);
 
@@ -429,16 +507,47 @@ class Simplex_tree {
       }
     }
     root_.members().clear();
+    // Releases all the siblings at once
+    arena_.reset();
   }
 
   // Recursive deletion
   void rec_delete(Siblings * sib) {
+    // Siblings in the arena are released with the arena
+    if (Simplex_tree_arena_allocation<Options>::value) return;
     for (auto sh = sib->members().begin(); sh != sib->members().end(); ++sh) {
       if (has_children(sh)) {
         rec_delete(sh->second.children());
       }
     }
-    delete sib;
+    delete_siblings(sib);
+  }
+
+  // Allocates and constructs siblings, on the heap or in the arena
+  template<typename... Args>
+  Siblings* new_siblings(Args&&... args) {
+    return new_siblings(std::integral_constant<bool, Simplex_tree_arena_allocation<Options>::value>(),
+                        std::forward<Args>(args)...);
+  }
+
+  template<typename... Args>
+  Siblings* new_siblings(std::false_type, Args&&... args) {
+    return new Siblings(std::forward<Args>(args)...);
+  }
+
+  template<typename... Args>
+  Siblings* new_siblings(std::true_type, Args&&... args) {
+    if (!arena_) arena_.reset(new Simplex_tree_arena());
+    void* sib = arena_->allocate(sizeof(Siblings), alignof(Siblings));
+    return new (sib) Siblings(std::forward<Args>(args)..., typename Siblings::Allocator(arena_.get()));
+  }
+
+  // Destroys and deallocates siblings created with new_siblings
+  void delete_siblings(Siblings* sib) {
+    if (Simplex_tree_arena_allocation<Options>::value)
+      sib->~Siblings();
+    else
+      delete sib;
   }
 
  public:
@@ -700,7 +809,7 @@ class Simplex_tree {
       GUDHI_CHECK(*vi != null_vertex(), "cannot use the dummy null_vertex() as a real vertex");
       res_insert = curr_sib->members_.emplace(*vi, Node(curr_sib, filtration));
       if (!(has_children(res_insert.first))) {
-        res_insert.first->second.assign_children(new Siblings(curr_sib, *vi));
+        res_insert.first->second.assign_children(new_siblings(curr_sib, *vi));
       }
       curr_sib = res_insert.first->second.children();
     }
@@ -829,7 +938,7 @@ class Simplex_tree {
     if (++first == last) return insertion_result;
     if (!has_children(simplex_one))
       // TODO: have special code here, we know we are building the whole subtree from scratch.
-      simplex_one->second.assign_children(new Siblings(sib, vertex_one));
+      simplex_one->second.assign_children(new_siblings(sib, vertex_one));
     auto res = rec_insert_simplex_and_subfaces_sorted(simplex_one->second.children(), first, last, filt);
     // No need to continue if the full simplex was already there with a low enough filtration value.
     if (res.first != null_simplex()) rec_insert_simplex_and_subfaces_sorted(sib, first, last, filt);
@@ -884,6 +993,7 @@ class Simplex_tree {
    * Any insertion, deletion or change of filtration value invalidates this cache,
    * which can be cleared with clear_filtration().  */
   void initialize_filtration() {
+    GUDHI_INSTRUMENT_SCOPE("Simplex_tree::initialize_filtration");
     filtration_vect_.clear();
     filtration_vect_.reserve(num_simplices());
     for (Simplex_handle sh : complex_simplex_range())
@@ -904,6 +1014,31 @@ class Simplex_tree {
     std::stable_sort(filtration_vect_.begin(), filtration_vect_.end(), is_before_in_filtration(this));
 #endif
   }
+  /** \brief Initializes the filtration cache, ordering the simplices by increasing filtration value, then by increasing
+   * dimension.
+   *
+   * Simplices with the same filtration value and dimension are in the order of `complex_simplex_range()`. As the faces
+   * of a simplex have a lower dimension, this is a valid order for any valid filtration, but it differs from the one of
+   * `initialize_filtration()` for simplices with the same filtration value. Instead of a comparison sort, the simplices
+   * are bucketed by dimension during a traversal of the tree, then ordered with a stable radix sort on the filtration
+   * values, which avoids dereferencing the simplex handles to compare them. This requires Filtration_value to be an
+   * integral type or a 32 or 64 bits floating-point type, otherwise `std::stable_sort` is used. NaN filtration values
+   * are not supported.
+   *
+   * It always recomputes the cache, even if one already exists. It is then used by `filtration_simplex_range()`, and
+   * by `Gudhi::persistent_cohomology::Persistent_cohomology`, until it is cleared. */
+  void initialize_filtration_by_dimension() {
+    // Number of simplices of each dimension, then offset of each dimension in the cache.
+    std::vector<std::size_t> dimension_offsets;
+    for_each_simplex_with_dimension(root(), 0, [&](Simplex_handle, int dim) {
+      if (dimension_offsets.size() <= static_cast<std::size_t>(dim) + 1) dimension_offsets.resize(dim + 2, 0);
+      ++dimension_offsets[dim + 1];
+    });
+    for (std::size_t dim = 1; dim < dimension_offsets.size(); ++dim)
+      dimension_offsets[dim] += dimension_offsets[dim - 1];
+    typedef std::integral_constant<bool, simplex_tree::Filtration_radix_key<Filtration_value>::value> Has_radix_key;
+    sort_filtration_by_dimension(dimension_offsets, Has_radix_key());
+  }
   /** \brief Initializes the filtration cache if it isn't initialized yet.
    *
    * Automatically called by filtration_simplex_range(). */
@@ -921,6 +1056,42 @@ class Simplex_tree {
   }
 
  private:
+  // Post-order depth first traversal, as complex_simplex_range(), that also gives the dimension of the simplices.
+  template<typename Function>
+  void for_each_simplex_with_dimension(Siblings* sib, int dim, Function&& f) {
+    for (auto sh = sib->members().begin(); sh != sib->members().end(); ++sh) {
+      if (has_children(sh)) for_each_simplex_with_dimension(sh->second.children(), dim + 1, f);
+      f(sh, dim);
+    }
+  }
+
+  // Simplices placed by dimension, then stable radix sort by filtration value.
+  void sort_filtration_by_dimension(std::vector<std::size_t>& dimension_offsets, std::true_type) {
+    typedef simplex_tree::Filtration_radix_key<Filtration_value> Radix_key;
+    typedef std::pair<typename Radix_key::Key, Simplex_handle> Key_simplex;
+    std::vector<Key_simplex> pairs(dimension_offsets.empty() ? 0 : dimension_offsets.back());
+    for_each_simplex_with_dimension(root(), 0, [&](Simplex_handle sh, int dim) {
+      pairs[dimension_offsets[dim]++] = std::make_pair(Radix_key::key(filtration(sh)), sh);
+    });
+    {
+      std::vector<Key_simplex> buffer;
+      simplex_tree::radix_sort_by_key(pairs, buffer);
+    }
+    filtration_vect_.clear();
+    filtration_vect_.reserve(pairs.size());
+    for (auto const& p : pairs) filtration_vect_.push_back(p.second);
+  }
+
+  void sort_filtration_by_dimension(std::vector<std::size_t>& dimension_offsets, std::false_type) {
+    filtration_vect_.resize(dimension_offsets.empty() ? 0 : dimension_offsets.back());
+    for_each_simplex_with_dimension(root(), 0, [&](Simplex_handle sh, int dim) {
+      filtration_vect_[dimension_offsets[dim]++] = sh;
+    });
+    std::stable_sort(filtration_vect_.begin(), filtration_vect_.end(), [](Simplex_handle sh1, Simplex_handle sh2) {
+      return filtration(sh1) < filtration(sh2);
+    });
+  }
+
   /** Recursive search of cofaces
    * This function uses DFS
    *\param vertices contains a list of vertices, which represent the vertices of the simplex not found yet.
@@ -1119,7 +1290,7 @@ class Simplex_tree {
       if (v < u) std::swap(u, v);
       auto sh = find_vertex(u);
       if (!has_children(sh)) {
-        sh->second.assign_children(new Siblings(&root_, sh->first));
+        sh->second.assign_children(new_siblings(&root_, sh->first));
       }
 
       sh->second.children()->members().emplace(v,
@@ -1140,23 +1311,58 @@ class Simplex_tree {
    * 1 when calling the method. */
   void expansion(int max_dim) {
     if (max_dim <= 1) return;
+    GUDHI_INSTRUMENT_SCOPE("Simplex_tree::expansion");
     clear_filtration(); // Drop the cache.
     dimension_ = max_dim;
     for (Dictionary_it root_it = root_.members_.begin();
          root_it != root_.members_.end(); ++root_it) {
       if (has_children(root_it)) {
-        siblings_expansion(root_it->second.children(), max_dim - 1);
+        siblings_expansion(root_it->second.children(), max_dim - 1, dimension_);
       }
     }
     dimension_ = max_dim - dimension_;
   }
 
+  /** \brief Same as `expansion()`, but the subtrees of the vertices are expanded in parallel if TBB is available.
+   *
+   * The resulting Simplex_tree is the same as the one of `expansion()`. With
+   * `SimplexTreeOptions::arena_allocation`, each thread allocates the new siblings in its own blocks of the arena.
+   *
+   * @warning The Simplex_tree must not be accessed by another thread during the expansion. */
+  void parallel_expansion(int max_dim) {
+    if (max_dim <= 1) return;
+    GUDHI_INSTRUMENT_SCOPE("Simplex_tree::parallel_expansion");
+    clear_filtration(); // Drop the cache.
+#ifdef GUDHI_USE_TBB
+    // The arena is created lazily with the first siblings, which must not happen concurrently.
+    if (Simplex_tree_arena_allocation<Options>::value && !arena_) arena_.reset(new Simplex_tree_arena());
+    // The expansion of the subtree of a vertex only reads the vertex and filtration value of the nodes of the other
+    // subtrees, that are not modified by their own expansion, hence the subtrees can be expanded concurrently.
+    int lowest_k = tbb::parallel_reduce(tbb::blocked_range<std::size_t>(0, root_.members_.size(), 1), max_dim,
+                                        [&](const tbb::blocked_range<std::size_t>& range, int lowest_k) {
+                                          for (std::size_t i = range.begin(); i != range.end(); ++i) {
+                                            Dictionary_it root_it = root_.members_.begin() + i;
+                                            if (has_children(root_it)) {
+                                              siblings_expansion(root_it->second.children(), max_dim - 1, lowest_k);
+                                            }
+                                          }
+                                          return lowest_k;
+                                        },
+                                        [](int k1, int k2) { return (std::min)(k1, k2); });
+    dimension_ = max_dim - lowest_k;
+#else
+    expansion(max_dim);
+#endif
+  }
+
  private:
-  /** \brief Recursive expansion of the simplex tree.*/
+  /** \brief Recursive expansion of the simplex tree.
+   *
+   * lowest_k is updated with the lowest value of k reached by the recursion. */
   void siblings_expansion(Siblings * siblings,  // must contain elements
-                          int k) {
-    if (dimension_ > k) {
-      dimension_ = k;
+                          int k, int& lowest_k) {
+    if (lowest_k > k) {
+      lowest_k = k;
     }
     if (k == 0)
       return;
@@ -1176,12 +1382,12 @@ class Simplex_tree {
                      root_sh->second.children()->members().end(),
                      s_h->second.filtration());
         if (inter.size() != 0) {
-          Siblings * new_sib = new Siblings(siblings,  // oncles
+          Siblings * new_sib = new_siblings(siblings,  // oncles
                                             s_h->first,  // parent
                                             inter);  // boost::container::ordered_unique_range_t
           inter.clear();
           s_h->second.assign_children(new_sib);
-          siblings_expansion(new_sib, k - 1);
+          siblings_expansion(new_sib, k - 1, lowest_k);
         } else {
           // ensure the children property
           s_h->second.assign_children(siblings);
@@ -1236,6 +1442,7 @@ class Simplex_tree {
    */
   template< typename Blocker >
   void expansion_with_blockers(int max_dim, Blocker block_simplex) {
+    GUDHI_INSTRUMENT_SCOPE("Simplex_tree::expansion_with_blockers");
     // Loop must be from the end to the beginning, as higher dimension simplex are always on the left part of the tree
     for (auto& simplex : boost::adaptors::reverse(root_.members())) {
       if (has_children(&simplex)) {
@@ -1244,6 +1451,50 @@ class Simplex_tree {
     }
   }
 
+  /** \brief Same as `expansion_with_blockers()`, but the candidates are processed in parallel if TBB is available.
+   *
+   * The complex is expanded dimension by dimension: all the candidates of a given dimension are inserted and vetted
+   * by `block_simplex`, concurrently, before the candidates of the next dimension are examined. The resulting
+   * Simplex_tree is the same as the one of `expansion_with_blockers()`, as long as the result of `block_simplex` on
+   * a simplex does not depend on the other simplices of the same dimension.
+   *
+   * @warning `block_simplex` may be called concurrently on different simplices, hence it must be thread-safe. It may
+   * modify the filtration value of the simplex it is called on, but it must not modify the rest of the complex.
+   */
+  template< typename Blocker >
+  void parallel_expansion_with_blockers(int max_dim, Blocker block_simplex) {
+    GUDHI_INSTRUMENT_SCOPE("Simplex_tree::parallel_expansion_with_blockers");
+    // The arena is created lazily with the first siblings, which must not happen concurrently.
+    if (Simplex_tree_arena_allocation<Options>::value && !arena_) arena_.reset(new Simplex_tree_arena());
+    // Sets of sibling simplices of the current dimension, whose cofaces are the candidates of the next dimension.
+    std::vector<Siblings*> siblings_to_expand;
+    for (auto& simplex : root_.members()) {
+      if (has_children(&simplex)) siblings_to_expand.push_back(simplex.second.children());
+    }
+    for (int dim = 1; !siblings_to_expand.empty(); ++dim) {
+      if (dimension_ < dim) dimension_ = dim;
+      if (dim >= max_dim) break;
+      // The expansion of a set of siblings only reads the simplices of the current dimension and below, that are
+      // not modified during the expansion of the other sets of siblings.
+      std::vector<std::vector<Siblings*>> new_siblings(siblings_to_expand.size());
+      auto expand = [&](std::size_t i) {
+        Siblings* siblings = siblings_to_expand[i];
+        if (siblings->members().size() < 2) return;
+        for (auto simplex = siblings->members().rbegin() + 1; simplex != siblings->members().rend(); simplex++) {
+          Siblings* new_sib = expand_simplex_with_blockers(siblings, simplex, block_simplex);
+          if (new_sib != nullptr) new_siblings[i].push_back(new_sib);
+        }
+      };
+#ifdef GUDHI_USE_TBB
+      tbb::parallel_for(std::size_t(0), siblings_to_expand.size(), expand);
+#else
+      for (std::size_t i = 0; i < siblings_to_expand.size(); ++i) expand(i);
+#endif
+      siblings_to_expand.clear();
+      for (auto& sibs : new_siblings) siblings_to_expand.insert(siblings_to_expand.end(), sibs.begin(), sibs.end());
+    }
+  }
+
  private:
   /** \brief Recursive expansion with blockers of the simplex tree.*/
   template< typename Blocker >
@@ -1258,58 +1509,72 @@ class Simplex_tree {
       return;
     // Reverse loop starting before the last one for 'next' to be the last one
     for (auto simplex = siblings->members().rbegin() + 1; simplex != siblings->members().rend(); simplex++) {
-      std::vector<std::pair<Vertex_handle, Node> > intersection;
-      for(auto next = siblings->members().rbegin(); next != simplex; next++) {
-        bool to_be_inserted = true;
-        Filtration_value filt = simplex->second.filtration();
-        // If all the boundaries are present, 'next' needs to be inserted
-        for (Simplex_handle border : boundary_simplex_range(simplex)) {
-          Simplex_handle border_child = find_child(border, next->first);
-          if (border_child == null_simplex()) {
-            to_be_inserted=false;
-            break;
-          }
-          filt = (std::max)(filt, filtration(border_child));
-        }
-        if (to_be_inserted) {
-          intersection.emplace_back(next->first, Node(nullptr, filt));
-        }
+      Siblings* new_sib = expand_simplex_with_blockers(siblings, simplex, block_simplex);
+      if (new_sib != nullptr) {
+        // ensure recursive call
+        siblings_expansion_with_blockers(new_sib, max_dim, k - 1, block_simplex);
       }
-      if (intersection.size() != 0) {
-        // Reverse the order to insert
-        Siblings * new_sib = new Siblings(siblings,  // oncles
-                                          simplex->first,  // parent
-                                          boost::adaptors::reverse(intersection));  // boost::container::ordered_unique_range_t
-        std::vector<Vertex_handle> blocked_new_sib_vertex_list;
-        // As all intersections are inserted, we can call the blocker function on all new_sib members
-        for (auto new_sib_member = new_sib->members().begin();
-             new_sib_member != new_sib->members().end();
-             new_sib_member++) {
-           bool blocker_result = block_simplex(new_sib_member);
-           // new_sib member has been blocked by the blocker function
-           // add it to the list to be removed - do not perform it while looping on it
-           if (blocker_result) {
-             blocked_new_sib_vertex_list.push_back(new_sib_member->first);
-           }
-        }
-        if (blocked_new_sib_vertex_list.size() == new_sib->members().size()) {
-          // Specific case where all have to be deleted
-          delete new_sib;
-          // ensure the children property
-          simplex->second.assign_children(siblings);
-        } else {
-          for (auto& blocked_new_sib_member : blocked_new_sib_vertex_list) {
-            new_sib->members().erase(blocked_new_sib_member);
-          }
-          // ensure recursive call
-          simplex->second.assign_children(new_sib);
-          siblings_expansion_with_blockers(new_sib, max_dim, k - 1, block_simplex);
+    }
+  }
+
+  /** \brief Inserts the cofaces of simplex with the simplices after it in siblings, whose faces are all in the
+   * complex, and removes the ones blocked by block_simplex.
+   *
+   * Returns the siblings of the inserted cofaces, or nullptr if there are none.*/
+  template< typename Blocker >
+  Siblings* expand_simplex_with_blockers(Siblings* siblings, typename Dictionary::reverse_iterator simplex,
+                                         Blocker& block_simplex) {
+    std::vector<std::pair<Vertex_handle, Node> > intersection;
+    for(auto next = siblings->members().rbegin(); next != simplex; next++) {
+      bool to_be_inserted = true;
+      Filtration_value filt = simplex->second.filtration();
+      // If all the boundaries are present, 'next' needs to be inserted
+      for (Simplex_handle border : boundary_simplex_range(simplex)) {
+        Simplex_handle border_child = find_child(border, next->first);
+        if (border_child == null_simplex()) {
+          to_be_inserted=false;
+          break;
         }
-      } else {
+        filt = (std::max)(filt, filtration(border_child));
+      }
+      if (to_be_inserted) {
+        intersection.emplace_back(next->first, Node(nullptr, filt));
+      }
+    }
+    if (intersection.size() != 0) {
+      // Reverse the order to insert
+      Siblings * new_sib = new_siblings(siblings,  // oncles
+                                        simplex->first,  // parent
+                                        boost::adaptors::reverse(intersection));  // boost::container::ordered_unique_range_t
+      std::vector<Vertex_handle> blocked_new_sib_vertex_list;
+      // As all intersections are inserted, we can call the blocker function on all new_sib members
+      for (auto new_sib_member = new_sib->members().begin();
+           new_sib_member != new_sib->members().end();
+           new_sib_member++) {
+         bool blocker_result = block_simplex(new_sib_member);
+         // new_sib member has been blocked by the blocker function
+         // add it to the list to be removed - do not perform it while looping on it
+         if (blocker_result) {
+           blocked_new_sib_vertex_list.push_back(new_sib_member->first);
+         }
+      }
+      if (blocked_new_sib_vertex_list.size() == new_sib->members().size()) {
+        // Specific case where all have to be deleted
+        delete_siblings(new_sib);
         // ensure the children property
         simplex->second.assign_children(siblings);
+      } else {
+        for (auto& blocked_new_sib_member : blocked_new_sib_vertex_list) {
+          new_sib->members().erase(blocked_new_sib_member);
+        }
+        simplex->second.assign_children(new_sib);
+        return new_sib;
       }
+    } else {
+      // ensure the children property
+      simplex->second.assign_children(siblings);
     }
+    return nullptr;
   }
 
   /* \private Returns the Simplex_handle composed of the vertex list (from the Simplex_handle), plus the given
@@ -1430,7 +1695,7 @@ class Simplex_tree {
     if (last == list.begin() && sib != root()) {
       // Removing the whole siblings, parent becomes a leaf.
       sib->oncles()->members()[sib->parent()].assign_children(sib->oncles());
-      delete sib;
+      delete_siblings(sib);
       // dimension may need to be lowered
       dimension_to_be_lowered_ = true;
       return true;
@@ -1498,7 +1763,7 @@ class Simplex_tree {
     } else {
       // Sibling is emptied : must be deleted, and its parent must point on his own Sibling
       child->oncles()->members().at(child->parent()).assign_children(child->oncles());
-      delete child;
+      delete_siblings(child);
       // dimension may need to be lowered
       dimension_to_be_lowered_ = true;
     }
@@ -1667,6 +1932,145 @@ class Simplex_tree {
     return sh; // None of its faces has the same filtration.
   }
 
+ public:
+  /** \brief Returns the size of the serialization of the Simplex_tree, in bytes.
+   *
+   * @see serialize() */
+  std::size_t get_serialization_size() {
+    const std::size_t node_byte_size = sizeof(Vertex_handle) +
+        (Options::store_filtration ? sizeof(Filtration_value) : 0) + (Options::store_key ? sizeof(Simplex_key) : 0);
+    // Each simplex is followed by the number of its children, and the vertices are preceded by their number.
+    return sizeof(Vertex_handle) + num_simplices() * (node_byte_size + sizeof(Vertex_handle));
+  }
+
+  /** \brief Serializes the Simplex_tree in a buffer, in a binary format independent of the memory layout of the tree.
+   *
+   * For each set of siblings, starting with the vertices, the serialization contains their number, then the vertex,
+   * the filtration value (if `SimplexTreeOptions::store_filtration`) and the key (if `SimplexTreeOptions::store_key`)
+   * of each of them, then recursively the serialization of the children of each of them, or 0 if it has none.
+   * Values are stored with the native byte order, hence a serialization can only be read by a `Simplex_tree` with
+   * the same `SimplexTreeOptions` types on a machine with the same endianness.
+   *
+   * @param[in] buffer Buffer of size at least `get_serialization_size()`, for instance a memory mapped file.
+   * @param[in] buffer_size Size of the buffer.
+   * @exception std::invalid_argument If the buffer is too small.
+   */
+  void serialize(char* buffer, const std::size_t buffer_size) {
+    if (buffer_size < get_serialization_size())
+      throw std::invalid_argument("Simplex_tree::serialize - buffer is too small");
+    rec_serialize(&root_, buffer);
+  }
+
+  /** \brief Deserializes a Simplex_tree serialized by `serialize()`.
+   *
+   * The buffer is only read, and each set of siblings is built from a single copy of its members, so that loading
+   * a memory mapped file does not parse the simplices one by one.
+   *
+   * @param[in] buffer Buffer containing the serialization of a `Simplex_tree` with the same `SimplexTreeOptions`.
+   * @param[in] buffer_size Size of the buffer.
+   * @exception std::invalid_argument If the buffer is too small for the serialization it contains.
+   * \pre The Simplex_tree is empty.
+   */
+  void deserialize(const char* buffer, const std::size_t buffer_size) {
+    GUDHI_CHECK(num_vertices() == 0, std::invalid_argument("Simplex_tree::deserialize - Simplex_tree is not empty"));
+    clear_filtration();
+    dimension_ = -1;
+    const char* buffer_end = buffer + buffer_size;
+    std::vector<std::vector<std::pair<Vertex_handle, Node>>> members_by_depth;
+    Vertex_handle members_size;
+    buffer = deserialize_value(members_size, buffer, buffer_end);
+    buffer = deserialize_members(members_by_depth, 0, members_size, buffer, buffer_end);
+    root_.members() = Dictionary(boost::container::ordered_unique_range, members_by_depth[0].begin(),
+                                 members_by_depth[0].end());
+    for (auto& map_el : root_.members()) {
+      map_el.second.assign_children(&root_);
+    }
+    rec_deserialize(&root_, members_by_depth, 0, buffer, buffer_end);
+  }
+
+ private:
+  char* rec_serialize(Siblings* sib, char* buffer) {
+    using simplex_tree::serialize_trivial;
+    buffer = serialize_trivial(static_cast<Vertex_handle>(sib->members().size()), buffer);
+    for (auto& map_el : sib->members()) {
+      buffer = serialize_trivial(map_el.first, buffer);
+      if (Options::store_filtration)
+        buffer = serialize_trivial(map_el.second.filtration(), buffer);
+      buffer = serialize_key(map_el.second, buffer, std::integral_constant<bool, Options::store_key>());
+    }
+    for (auto sh = sib->members().begin(); sh != sib->members().end(); ++sh) {
+      if (has_children(sh))
+        buffer = rec_serialize(sh->second.children(), buffer);
+      else
+        buffer = serialize_trivial(static_cast<Vertex_handle>(0), buffer);
+    }
+    return buffer;
+  }
+
+  static char* serialize_key(const Node& node, char* buffer, std::true_type) {
+    return simplex_tree::serialize_trivial(node.key(), buffer);
+  }
+
+  static char* serialize_key(const Node&, char* buffer, std::false_type) {
+    return buffer;
+  }
+
+  template<typename Value>
+  static const char* deserialize_value(Value& value, const char* buffer, const char* buffer_end) {
+    if (buffer_end - buffer < static_cast<std::ptrdiff_t>(sizeof(Value)))
+      throw std::invalid_argument("Simplex_tree::deserialize - buffer is too small");
+    return simplex_tree::deserialize_trivial(value, buffer);
+  }
+
+  // Reads members_size members in members_by_depth[depth].
+  const char* deserialize_members(std::vector<std::vector<std::pair<Vertex_handle, Node>>>& members_by_depth,
+                                  std::size_t depth, Vertex_handle members_size, const char* buffer,
+                                  const char* buffer_end) {
+    if (members_by_depth.size() <= depth) members_by_depth.resize(depth + 1);
+    auto& members = members_by_depth[depth];
+    members.clear();
+    members.reserve(members_size);
+    for (Vertex_handle i = 0; i < members_size; ++i) {
+      Vertex_handle vertex;
+      Filtration_value filtration = 0;
+      buffer = deserialize_value(vertex, buffer, buffer_end);
+      if (Options::store_filtration)
+        buffer = deserialize_value(filtration, buffer, buffer_end);
+      members.emplace_back(vertex, Node(nullptr, filtration));
+      buffer = deserialize_key(members.back().second, buffer, buffer_end,
+                               std::integral_constant<bool, Options::store_key>());
+    }
+    if (members_size > 0 && dimension_ < static_cast<int>(depth)) dimension_ = static_cast<int>(depth);
+    return buffer;
+  }
+
+  static const char* deserialize_key(Node& node, const char* buffer, const char* buffer_end, std::true_type) {
+    Simplex_key key;
+    buffer = deserialize_value(key, buffer, buffer_end);
+    node.assign_key(key);
+    return buffer;
+  }
+
+  static const char* deserialize_key(Node&, const char* buffer, const char*, std::false_type) {
+    return buffer;
+  }
+
+  // Reads the children of the members of sib, which is at the given depth.
+  const char* rec_deserialize(Siblings* sib, std::vector<std::vector<std::pair<Vertex_handle, Node>>>& members_by_depth,
+                              std::size_t depth, const char* buffer, const char* buffer_end) {
+    for (auto sh = sib->members().begin(); sh != sib->members().end(); ++sh) {
+      Vertex_handle members_size;
+      buffer = deserialize_value(members_size, buffer, buffer_end);
+      if (members_size > 0) {
+        buffer = deserialize_members(members_by_depth, depth + 1, members_size, buffer, buffer_end);
+        Siblings* child = new_siblings(sib, sh->first, members_by_depth[depth + 1]);
+        sh->second.assign_children(child);
+        buffer = rec_deserialize(child, members_by_depth, depth + 1, buffer, buffer_end);
+      }
+    }
+    return buffer;
+  }
+
  private:
   Vertex_handle null_vertex_;
   /** \brief Total number of simplices in the complex, without the empty simplex.*/
@@ -1677,6 +2081,8 @@ class Simplex_tree {
   /** \brief Upper bound on the dimension of the simplicial complex.*/
   int dimension_;
   bool dimension_to_be_lowered_ = false;
+  /** \brief Memory of the siblings if SimplexTreeOptions::arena_allocation, created with the first siblings.*/
+  std::unique_ptr<Simplex_tree_arena> arena_;
 };
 
 // Print a Simplex_tree in os.
@@ -1726,6 +2132,7 @@ struct Simplex_tree_options_full_featured {
   static const bool store_key = true;
   static const bool store_filtration = true;
   static const bool contiguous_vertices = false;
+  static const bool arena_allocation = false;
 };
 
 /** Model of SimplexTreeOptions, faster than `Simplex_tree_options_full_featured` but note the unsafe
@@ -1742,6 +2149,7 @@ struct Simplex_tree_options_fast_persistence {
   static const bool store_key = true;
   static const bool store_filtration = true;
   static const bool contiguous_vertices = true;
+  static const bool arena_allocation = false;
 };
 
 /** @} */  // end defgroup simplex_tree
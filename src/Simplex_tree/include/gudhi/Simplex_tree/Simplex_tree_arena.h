@@ -0,0 +1,121 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Clément Maria
+ *
+ *    Copyright (C) 2020 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef SIMPLEX_TREE_SIMPLEX_TREE_ARENA_H_
+#define SIMPLEX_TREE_SIMPLEX_TREE_ARENA_H_
+
+#ifdef GUDHI_USE_TBB
+#include <tbb/enumerable_thread_specific.h>
+#endif
+
+#include <vector>
+#include <memory>  // for std::unique_ptr, std::allocator
+#include <cstddef>  // for std::size_t, std::max_align_t
+#include <cstdint>  // for std::uintptr_t
+#include <algorithm>  // for std::max
+#include <type_traits>  // for std::integral_constant
+
+namespace Gudhi {
+
+/* \brief Monotonic memory arena for the siblings of a Simplex_tree and their dictionaries.
+ *
+ * Memory is allocated by bumping a pointer in blocks of increasing size, deallocation does nothing, and all the
+ * memory is released at once when the arena is destroyed. With TBB, each thread allocates in its own blocks, so that
+ * the allocation is thread-safe without locking. */
+class Simplex_tree_arena {
+ private:
+  // Blocks allocated by one thread.
+  class Block_list {
+   public:
+    void* allocate(std::size_t bytes, std::size_t alignment) {
+      std::uintptr_t aligned = (current_ + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+      if (blocks_.empty() || aligned + bytes > end_) {
+        // Large requests have their own block, other requests open a new block.
+        std::size_t block_size = (std::max)(next_block_size_, bytes + alignment);
+        if (block_size == next_block_size_ && next_block_size_ < max_block_size) next_block_size_ *= 2;
+        blocks_.emplace_back(new char[block_size]);
+        current_ = reinterpret_cast<std::uintptr_t>(blocks_.back().get());
+        end_ = current_ + block_size;
+        aligned = (current_ + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+      }
+      current_ = aligned + bytes;
+      return reinterpret_cast<void*>(aligned);
+    }
+
+   private:
+    static const std::size_t min_block_size = 1 << 16;
+    static const std::size_t max_block_size = 1 << 24;
+    std::vector<std::unique_ptr<char[]>> blocks_;
+    std::uintptr_t current_ = 0;
+    std::uintptr_t end_ = 0;
+    std::size_t next_block_size_ = min_block_size;
+  };
+
+ public:
+  void* allocate(std::size_t bytes, std::size_t alignment) {
+#ifdef GUDHI_USE_TBB
+    return blocks_.local().allocate(bytes, alignment);
+#else
+    return blocks_.allocate(bytes, alignment);
+#endif
+  }
+
+ private:
+#ifdef GUDHI_USE_TBB
+  tbb::enumerable_thread_specific<Block_list> blocks_;
+#else
+  Block_list blocks_;
+#endif
+};
+
+/* \brief Allocator in a Simplex_tree_arena. A default constructed allocator uses the heap. */
+template<typename T>
+class Simplex_tree_arena_allocator {
+ public:
+  typedef T value_type;
+
+  Simplex_tree_arena_allocator() noexcept : arena_(nullptr) {}
+  explicit Simplex_tree_arena_allocator(Simplex_tree_arena* arena) noexcept : arena_(arena) {}
+  template<typename U>
+  Simplex_tree_arena_allocator(const Simplex_tree_arena_allocator<U>& other) noexcept : arena_(other.arena()) {}
+
+  T* allocate(std::size_t n) {
+    if (arena_ == nullptr) return std::allocator<T>().allocate(n);
+    return static_cast<T*>(arena_->allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T* p, std::size_t n) noexcept {
+    // Memory in the arena is released with the arena
+    if (arena_ == nullptr) std::allocator<T>().deallocate(p, n);
+  }
+
+  Simplex_tree_arena* arena() const noexcept { return arena_; }
+
+  template<typename U>
+  bool operator==(const Simplex_tree_arena_allocator<U>& other) const noexcept { return arena_ == other.arena(); }
+  template<typename U>
+  bool operator!=(const Simplex_tree_arena_allocator<U>& other) const noexcept { return arena_ != other.arena(); }
+
+ private:
+  Simplex_tree_arena* arena_;
+};
+
+/* \brief Whether the siblings of a Simplex_tree with options SimplexTreeOptions are allocated in a
+ * Simplex_tree_arena, i.e. `SimplexTreeOptions::arena_allocation`, or false if it is not defined. */
+template<typename SimplexTreeOptions, typename = void>
+struct Simplex_tree_arena_allocation : std::false_type {};
+
+template<typename SimplexTreeOptions>
+struct Simplex_tree_arena_allocation<SimplexTreeOptions, decltype(void(SimplexTreeOptions::arena_allocation))>
+    : std::integral_constant<bool, SimplexTreeOptions::arena_allocation> {};
+
+}  // namespace Gudhi
+
+#endif  // SIMPLEX_TREE_SIMPLEX_TREE_ARENA_H_
@@ -0,0 +1,98 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Clément Maria
+ *
+ *    Copyright (C) 2020 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef SIMPLEX_TREE_SIMPLEX_TREE_RADIX_SORT_H_
+#define SIMPLEX_TREE_SIMPLEX_TREE_RADIX_SORT_H_
+
+#include <vector>
+#include <utility>  // for std::pair
+#include <cstring>  // for std::memcpy
+#include <cstdint>  // for std::uint32_t, std::uint64_t
+#include <cstddef>  // for std::size_t
+#include <limits>
+#include <type_traits>  // for std::enable_if, std::make_unsigned
+
+namespace Gudhi {
+
+namespace simplex_tree {
+
+/* \brief Unsigned integer key of a filtration value, such that the order of the keys is the order of the filtration
+ * values, i.e. `key(f1) < key(f2)` iff `f1 < f2`. Defined for IEEE floating-point types of 32 or 64 bits, NaN
+ * excepted, and for integral types. `Filtration_radix_key<T>::value` is false for the other types. */
+template<typename Filtration_value, typename = void>
+struct Filtration_radix_key {
+  static const bool value = false;
+};
+
+template<typename Filtration_value>
+struct Filtration_radix_key<Filtration_value, typename std::enable_if<std::is_integral<Filtration_value>::value &&
+                                                    !std::is_same<Filtration_value, bool>::value>::type> {
+  static const bool value = true;
+  typedef typename std::make_unsigned<Filtration_value>::type Key;
+  static Key key(Filtration_value f) {
+    // Flipping the sign bit maps the signed values to the unsigned ones in the same order.
+    return static_cast<Key>(f) ^ (std::is_signed<Filtration_value>::value ? ~((~Key(0)) >> 1) : Key(0));
+  }
+};
+
+template<typename Filtration_value>
+struct Filtration_radix_key<Filtration_value,
+                            typename std::enable_if<std::numeric_limits<Filtration_value>::is_iec559 &&
+                                                    (sizeof(Filtration_value) == 4 ||
+                                                     sizeof(Filtration_value) == 8)>::type> {
+  static const bool value = true;
+  typedef typename std::conditional<sizeof(Filtration_value) == 4, std::uint32_t, std::uint64_t>::type Key;
+  static Key key(Filtration_value f) {
+    // -0. and 0. are equal, they must have the same key.
+    if (f == 0) f = 0;
+    Key bits;
+    std::memcpy(&bits, &f, sizeof(Key));
+    const Key sign_bit = ~((~Key(0)) >> 1);
+    // Negative values are in the reverse order of their bits.
+    return (bits & sign_bit) ? ~bits : (bits | sign_bit);
+  }
+};
+
+/* \brief Stable least significant digit radix sort of the pairs (key, value) by key.
+ *
+ * buffer is used as temporary storage. Digits whose value is the same for all the keys are skipped. */
+template<typename Key, typename Value>
+void radix_sort_by_key(std::vector<std::pair<Key, Value>>& pairs, std::vector<std::pair<Key, Value>>& buffer) {
+  const int digit_bits = 11;
+  const std::size_t num_buckets = std::size_t(1) << digit_bits;
+  const int num_digits = (static_cast<int>(sizeof(Key)) * 8 + digit_bits - 1) / digit_bits;
+  const Key digit_mask = static_cast<Key>(num_buckets - 1);
+  if (pairs.size() < 2) return;
+
+  // All the histograms are computed in a single pass.
+  std::vector<std::size_t> counts(num_digits * num_buckets, 0);
+  for (auto const& p : pairs)
+    for (int d = 0; d < num_digits; ++d) ++counts[d * num_buckets + ((p.first >> (d * digit_bits)) & digit_mask)];
+
+  buffer.resize(pairs.size());
+  for (int d = 0; d < num_digits; ++d) {
+    std::size_t* count = &counts[d * num_buckets];
+    if (count[(pairs.front().first >> (d * digit_bits)) & digit_mask] == pairs.size()) continue;
+    std::size_t offset = 0;
+    for (std::size_t b = 0; b < num_buckets; ++b) {
+      std::size_t c = count[b];
+      count[b] = offset;
+      offset += c;
+    }
+    for (auto const& p : pairs) buffer[count[(p.first >> (d * digit_bits)) & digit_mask]++] = p;
+    pairs.swap(buffer);
+  }
+}
+
+}  // namespace simplex_tree
+
+}  // namespace Gudhi
+
+#endif  // SIMPLEX_TREE_SIMPLEX_TREE_RADIX_SORT_H_
@@ -42,6 +42,7 @@ class Simplex_tree_siblings {
   typedef typename SimplexTree::Node Node;
   typedef MapContainer Dictionary;
   typedef typename MapContainer::iterator Dictionary_it;
+  typedef typename MapContainer::allocator_type Allocator;
 
   /* Default constructor.*/
   Simplex_tree_siblings()
@@ -51,21 +52,22 @@ class Simplex_tree_siblings {
   }
 
   /* Constructor with values.*/
-  Simplex_tree_siblings(Simplex_tree_siblings * oncles, Vertex_handle parent)
+  Simplex_tree_siblings(Simplex_tree_siblings * oncles, Vertex_handle parent, const Allocator& allocator = Allocator())
       : oncles_(oncles),
         parent_(parent),
-        members_() {
+        members_(allocator) {
   }
 
   /* \brief Constructor with initialized set of members.
    *
    * 'members' must be sorted and unique.*/
   template<typename RandomAccessVertexRange>
-  Simplex_tree_siblings(Simplex_tree_siblings * oncles, Vertex_handle parent, const RandomAccessVertexRange & members)
+  Simplex_tree_siblings(Simplex_tree_siblings * oncles, Vertex_handle parent, const RandomAccessVertexRange & members,
+                        const Allocator& allocator = Allocator())
       : oncles_(oncles),
         parent_(parent),
         members_(boost::container::ordered_unique_range, members.begin(),
-                 members.end()) {
+                 members.end(), typename MapContainer::key_compare(), allocator) {
     for (auto& map_el : members_) {
       map_el.second.assign_children(this);
     }
@@ -0,0 +1,42 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Clément Maria
+ *
+ *    Copyright (C) 2020 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef SIMPLEX_TREE_SERIALIZATION_UTILS_H_
+#define SIMPLEX_TREE_SERIALIZATION_UTILS_H_
+
+#include <cstring>  // for memcpy
+
+namespace Gudhi {
+
+namespace simplex_tree {
+
+/* \brief Copies the bytes of value at start, and returns the position after them.
+ *
+ * ArgumentType must be trivially copyable. The bytes are in the native endianness. */
+template<class ArgumentType>
+char* serialize_trivial(ArgumentType value, char* start) {
+  std::memcpy(start, &value, sizeof(ArgumentType));
+  return start + sizeof(ArgumentType);
+}
+
+/* \brief Copies the bytes at start in value, and returns the position after them.
+ *
+ * ArgumentType must be trivially copyable. The bytes are in the native endianness. */
+template<class ArgumentType>
+const char* deserialize_trivial(ArgumentType& value, const char* start) {
+  std::memcpy(&value, start, sizeof(ArgumentType));
+  return start + sizeof(ArgumentType);
+}
+
+}  // namespace simplex_tree
+
+}  // namespace Gudhi
+
+#endif  // SIMPLEX_TREE_SERIALIZATION_UTILS_H_
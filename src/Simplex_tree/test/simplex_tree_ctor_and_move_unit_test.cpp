@@ -11,6 +11,8 @@
 #include <iostream>
 #include <vector>
 #include <string>
+#include <utility>  // for std::pair
+#include <algorithm>  // for std::sort, std::reverse
 
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MODULE "simplex_tree_constructor_and_move"
@@ -23,7 +25,12 @@
 
 using namespace Gudhi;
 
-typedef boost::mpl::list<Simplex_tree<>, Simplex_tree<Simplex_tree_options_fast_persistence>> list_of_tested_variants;
+struct Simplex_tree_options_arena : Simplex_tree_options_full_featured {
+  static const bool arena_allocation = true;
+};
+
+typedef boost::mpl::list<Simplex_tree<>, Simplex_tree<Simplex_tree_options_fast_persistence>,
+                         Simplex_tree<Simplex_tree_options_arena>> list_of_tested_variants;
 
 template<typename Simplex_tree>
 void print_simplex_filtration(Simplex_tree& st, const std::string& msg) {
@@ -145,3 +152,54 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(simplex_copy_constructor, Simplex_tree, list_of_te
   BOOST_CHECK(st7 == st);
 
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(simplex_sorted_range_constructor, Simplex_tree, list_of_tested_variants) {
+  Simplex_tree st;
+
+  st.insert_simplex_and_subfaces({2, 1, 0}, 3.0);
+  st.insert_simplex_and_subfaces({0, 1, 6, 7}, 4.0);
+  st.insert_simplex_and_subfaces({3, 0}, 2.0);
+  st.insert_simplex_and_subfaces({3, 4, 5}, 3.0);
+  st.insert_simplex_and_subfaces({8}, 1.0);
+
+  typedef typename Simplex_tree::Vertex_handle Vertex_handle;
+  typedef typename Simplex_tree::Filtration_value Filtration_value;
+  typedef std::pair<std::vector<Vertex_handle>, Filtration_value> Simplex_and_filtration;
+  std::vector<Simplex_and_filtration> simplices;
+  for (auto sh : st.complex_simplex_range()) {
+    // simplex_vertex_range is in decreasing order
+    auto vertices = st.simplex_vertex_range(sh);
+    simplices.emplace_back(std::vector<Vertex_handle>(vertices.begin(), vertices.end()), st.filtration(sh));
+    std::reverse(simplices.back().first.begin(), simplices.back().first.end());
+  }
+  std::sort(simplices.begin(), simplices.end());
+
+  std::clog << "********************************************************************" << std::endl;
+  std::clog << "TEST OF CONSTRUCTOR FROM A SORTED RANGE" << std::endl;
+  Simplex_tree st_from_range(boost::container::ordered_unique_range, simplices);
+  print_simplex_filtration(st_from_range, "Simplex_tree built from a sorted range");
+
+  BOOST_CHECK(st_from_range == st);
+  BOOST_CHECK(st_from_range.dimension() == 3);
+  BOOST_CHECK(st_from_range.num_simplices() == simplices.size());
+
+  Simplex_tree st_from_empty_range(boost::container::ordered_unique_range, std::vector<Simplex_and_filtration>());
+  BOOST_CHECK(st_from_empty_range.num_simplices() == 0);
+  BOOST_CHECK(st_from_empty_range.dimension() == -1);
+
+#ifdef GUDHI_DEBUG
+  std::clog << "TEST OF CONSTRUCTOR FROM A SORTED RANGE WITH MISSING FACES" << std::endl;
+  // Missing prefix face, even of the first simplex
+  std::vector<Simplex_and_filtration> no_vertex_0{{{0, 1}, 1.}, {{1}, 0.}};
+  BOOST_CHECK_THROW(Simplex_tree(boost::container::ordered_unique_range, no_vertex_0), std::invalid_argument);
+  // Missing faces that come after the simplex in lexicographical order
+  std::vector<Simplex_and_filtration> no_vertex_1{{{0}, 0.}, {{0, 1}, 1.}};
+  BOOST_CHECK_THROW(Simplex_tree(boost::container::ordered_unique_range, no_vertex_1), std::invalid_argument);
+  std::vector<Simplex_and_filtration> no_edge_12{{{0}, 0.}, {{0, 1}, 1.}, {{0, 1, 2}, 2.}, {{0, 2}, 1.}, {{1}, 0.},
+                                                 {{2}, 0.}};
+  BOOST_CHECK_THROW(Simplex_tree(boost::container::ordered_unique_range, no_edge_12), std::invalid_argument);
+  // Not sorted
+  std::vector<Simplex_and_filtration> not_sorted{{{1}, 0.}, {{0}, 0.}};
+  BOOST_CHECK_THROW(Simplex_tree(boost::container::ordered_unique_range, not_sorted), std::invalid_argument);
+#endif  // GUDHI_DEBUG
+}
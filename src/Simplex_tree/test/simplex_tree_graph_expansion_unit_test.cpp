@@ -16,6 +16,7 @@
 #include <cmath> // float comparison
 #include <limits>
 #include <functional> // greater
+#include <cstdlib>  // for std::rand
 
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MODULE "simplex_tree"
@@ -28,7 +29,12 @@
 
 using namespace Gudhi;
 
-typedef boost::mpl::list<Simplex_tree<>, Simplex_tree<Simplex_tree_options_fast_persistence>> list_of_tested_variants;
+struct Simplex_tree_options_arena : Simplex_tree_options_full_featured {
+  static const bool arena_allocation = true;
+};
+
+typedef boost::mpl::list<Simplex_tree<>, Simplex_tree<Simplex_tree_options_fast_persistence>,
+                         Simplex_tree<Simplex_tree_options_arena>> list_of_tested_variants;
 
 
 bool AreAlmostTheSame(float a, float b) {
@@ -243,3 +249,68 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(simplex_tree_expansion_2, typeST, list_of_tested_v
   BOOST_CHECK(AreAlmostTheSame(simplex_tree.filtration(simplex_tree.find({1,2,3})), 5.));
   BOOST_CHECK(simplex_tree.find({0,1,2,3}) == simplex_tree.null_simplex());
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(simplex_tree_parallel_expansion_with_blockers, typeST, list_of_tested_variants) {
+  using Simplex_handle = typename typeST::Simplex_handle;
+  // Random graph, dense enough to have cliques of size 5
+  typeST graph;
+  std::srand(7);
+  for (int u = 0; u < 30; u++) {
+    graph.insert_simplex({u}, 0.);
+    for (int v = 0; v < u; v++) {
+      if (std::rand() % 3 != 0)
+        graph.insert_simplex({v, u}, static_cast<float>(std::rand() % 100));
+    }
+  }
+
+  for (int max_dim : {1, 2, 4}) {
+    std::clog << "simplex_tree_parallel_expansion_with_blockers - max_dim = " << max_dim << std::endl;
+    typeST stree(graph);
+    stree.expansion(max_dim);
+    typeST stree_parallel(graph);
+    // Nothing blocked, the result is the same as the expansion
+    stree_parallel.parallel_expansion_with_blockers(max_dim, [](Simplex_handle) { return false; });
+    BOOST_CHECK(stree == stree_parallel);
+    BOOST_CHECK(stree.dimension() == stree_parallel.dimension());
+
+    // The blocker modifies the filtration values and only depends on the blocked simplex
+    auto make_blocker = [](typeST& st) {
+      return [&st](Simplex_handle sh) {
+        st.assign_filtration(sh, st.filtration(sh) + 1.);
+        return st.filtration(sh) > 90.;
+      };
+    };
+    typeST stree_blocked(graph);
+    stree_blocked.expansion_with_blockers(max_dim, make_blocker(stree_blocked));
+    typeST stree_parallel_blocked(graph);
+    stree_parallel_blocked.parallel_expansion_with_blockers(max_dim, make_blocker(stree_parallel_blocked));
+    std::clog << "  " << stree_blocked.num_simplices() << " simplices - dimension " << stree_blocked.dimension()
+              << std::endl;
+    BOOST_CHECK(stree_blocked == stree_parallel_blocked);
+    BOOST_CHECK(stree_blocked.dimension() == stree_parallel_blocked.dimension());
+  }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(simplex_tree_parallel_expansion, typeST, list_of_tested_variants) {
+  // Random graph, dense enough to have cliques of size 5
+  typeST graph;
+  std::srand(11);
+  for (int u = 0; u < 40; u++) {
+    graph.insert_simplex({u}, 0.);
+    for (int v = 0; v < u; v++) {
+      if (std::rand() % 3 != 0)
+        graph.insert_simplex({v, u}, static_cast<float>(std::rand() % 100));
+    }
+  }
+
+  for (int max_dim : {1, 2, 3, 6}) {
+    std::clog << "simplex_tree_parallel_expansion - max_dim = " << max_dim << std::endl;
+    typeST stree(graph);
+    stree.expansion(max_dim);
+    typeST stree_parallel(graph);
+    stree_parallel.parallel_expansion(max_dim);
+    std::clog << "  " << stree.num_simplices() << " simplices - dimension " << stree.dimension() << std::endl;
+    BOOST_CHECK(stree == stree_parallel);
+    BOOST_CHECK(stree.dimension() == stree_parallel.dimension());
+  }
+}
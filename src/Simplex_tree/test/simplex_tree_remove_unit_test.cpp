@@ -28,8 +28,14 @@ struct MyOptions : Simplex_tree_options_full_featured {
   typedef short Vertex_handle;
 };
 
+struct Arena_options : Simplex_tree_options_full_featured {
+  // Removed simplices are released with the tree
+  static const bool arena_allocation = true;
+};
+
 using Mini_stree = Simplex_tree<MyOptions>;
 using Stree = Simplex_tree<>;
+using Arena_stree = Simplex_tree<Arena_options>;
 
 BOOST_AUTO_TEST_CASE(remove_maximal_simplex) {
   std::clog << "********************************************************************" << std::endl;
@@ -435,3 +441,45 @@ BOOST_AUTO_TEST_CASE(mini_prune_above_filtration) {
   std::clog << "The complex contains " << st.num_simplices() << " simplices" << std::endl;
 
 }
+
+BOOST_AUTO_TEST_CASE(remove_and_prune_with_arena) {
+  std::clog << "********************************************************************" << std::endl;
+  std::clog << "REMOVE AND PRUNE WITH ARENA ALLOCATION" << std::endl;
+
+  Arena_stree st;
+  st.insert_simplex_and_subfaces({0, 1, 6, 7}, 1.0);
+  st.insert_simplex_and_subfaces({3, 4, 5}, 2.0);
+  st.insert_simplex_and_subfaces({3, 0}, 3.0);
+  st.insert_simplex_and_subfaces({2, 1, 0}, 4.0);
+
+  Arena_stree st_wo_seven;
+  st_wo_seven.insert_simplex_and_subfaces({0, 1, 6}, 1.0);
+  st_wo_seven.insert_simplex_and_subfaces({3, 4, 5}, 2.0);
+  st_wo_seven.insert_simplex_and_subfaces({3, 0}, 3.0);
+  st_wo_seven.insert_simplex_and_subfaces({2, 1, 0}, 4.0);
+
+  // Removes the children of 7, then the Siblings that become empty
+  for (auto simplex : {std::vector<int>{0, 1, 6, 7}, {0, 1, 7}, {0, 6, 7}, {0, 7}, {1, 6, 7}, {1, 7}, {6, 7}, {7}})
+    st.remove_maximal_simplex(st.find(simplex));
+  // dimension() lowers the upper bound of the dimension before the comparison
+  BOOST_CHECK(st.dimension() == 2);
+  BOOST_CHECK(st == st_wo_seven);
+
+  // Copies and moves do not share the arena of their source
+  Arena_stree st_copy(st);
+  Arena_stree st_moved(std::move(st_copy));
+  BOOST_CHECK(st_moved == st_wo_seven);
+
+  BOOST_CHECK(st.prune_above_filtration(2.5));
+  Arena_stree st_pruned;
+  st_pruned.insert_simplex_and_subfaces({0, 1, 6}, 1.0);
+  st_pruned.insert_simplex_and_subfaces({3, 4, 5}, 2.0);
+  BOOST_CHECK(st == st_pruned);
+  BOOST_CHECK(st_moved == st_wo_seven);
+
+  st_moved = st;
+  BOOST_CHECK(st_moved == st_pruned);
+  st = Arena_stree();
+  BOOST_CHECK(st.num_simplices() == 0);
+  BOOST_CHECK(st_moved == st_pruned);
+}
@@ -17,6 +17,8 @@
 #include <limits>
 #include <functional>  // greater
 #include <tuple>  // std::tie
+#include <random>
+#include <vector>
 
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MODULE "simplex_tree"
@@ -29,7 +31,12 @@
 
 using namespace Gudhi;
 
-typedef boost::mpl::list<Simplex_tree<>, Simplex_tree<Simplex_tree_options_fast_persistence>> list_of_tested_variants;
+struct Simplex_tree_options_arena : Simplex_tree_options_full_featured {
+  static const bool arena_allocation = true;
+};
+
+typedef boost::mpl::list<Simplex_tree<>, Simplex_tree<Simplex_tree_options_fast_persistence>,
+                         Simplex_tree<Simplex_tree_options_arena>> list_of_tested_variants;
 
 
 template<class typeST>
@@ -940,3 +947,82 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(generators, typeST, list_of_tested_variants) {
     BOOST_CHECK(st.edge_with_same_filtration(st.find({1,5}))==st.find({1,5}));
   }
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(serialization, typeST, list_of_tested_variants) {
+  std::clog << "********************************************************************" << std::endl;
+  std::clog << "TEST SERIALIZATION" << std::endl;
+  typeST st;
+  st.insert_simplex_and_subfaces({2, 1, 0}, 3.);
+  st.insert_simplex_and_subfaces({3, 0}, 2.);
+  st.insert_simplex_and_subfaces({3, 4, 5}, 1.);
+  st.insert_simplex_and_subfaces({0, 1, 6, 7}, 4.);
+  st.insert_simplex_and_subfaces({8}, 0.5);
+  st.assign_filtration(st.find({1, 6}), 5.);
+  st.initialize_filtration();
+  typename typeST::Simplex_key key = 0;
+  for (auto sh : st.filtration_simplex_range())
+    st.assign_key(sh, key++);
+
+  std::size_t buffer_size = st.get_serialization_size();
+  std::vector<char> buffer(buffer_size);
+  st.serialize(buffer.data(), buffer_size);
+  BOOST_CHECK_THROW(st.serialize(buffer.data(), buffer_size - 1), std::invalid_argument);
+
+  typeST st_from_buffer;
+  st_from_buffer.deserialize(buffer.data(), buffer_size);
+  BOOST_CHECK(st == st_from_buffer);
+  BOOST_CHECK(st.dimension() == st_from_buffer.dimension());
+  for (auto sh : st.complex_simplex_range()) {
+    std::vector<typename typeST::Vertex_handle> simplex;
+    for (auto vertex : st.simplex_vertex_range(sh))
+      simplex.push_back(vertex);
+    BOOST_CHECK(st.key(sh) == st_from_buffer.key(st_from_buffer.find(simplex)));
+  }
+
+  typeST st_truncated;
+  BOOST_CHECK_THROW(st_truncated.deserialize(buffer.data(), buffer_size - 1), std::invalid_argument);
+
+  typeST st_empty, st_empty_from_buffer;
+  std::vector<char> empty_buffer(st_empty.get_serialization_size());
+  st_empty.serialize(empty_buffer.data(), empty_buffer.size());
+  st_empty_from_buffer.deserialize(empty_buffer.data(), empty_buffer.size());
+  BOOST_CHECK(st_empty_from_buffer.num_simplices() == 0);
+  BOOST_CHECK(st_empty_from_buffer.dimension() == -1);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(filtration_by_dimension, typeST, list_of_tested_variants) {
+  std::clog << "********************************************************************" << std::endl;
+  std::clog << "TEST FILTRATION ORDERED BY DIMENSION" << std::endl;
+  typedef typename typeST::Simplex_handle Simplex_handle;
+  typedef typename typeST::Filtration_value Filtration_value;
+  typeST st;
+  st.initialize_filtration_by_dimension();
+  BOOST_CHECK(st.filtration_simplex_range().empty());
+
+  // Many equal filtration values, some negative ones and an infinite one
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int> vertex(0, 19);
+  std::uniform_int_distribution<int> value(-3, 12);
+  for (int i = 0; i < 60; ++i)
+    st.insert_simplex_and_subfaces({vertex(gen), vertex(gen), vertex(gen), vertex(gen)}, value(gen) / 4.);
+  st.insert_simplex_and_subfaces({20, 21}, std::numeric_limits<Filtration_value>::infinity());
+  st.insert_simplex_and_subfaces({22}, -0.);
+  st.make_filtration_non_decreasing();
+
+  st.initialize_filtration_by_dimension();
+  std::vector<Simplex_handle> filtration(st.filtration_simplex_range().begin(), st.filtration_simplex_range().end());
+  BOOST_CHECK(filtration.size() == st.num_simplices());
+  typename typeST::Simplex_key key = 0;
+  for (auto sh : filtration) {
+    if (key > 0) {
+      Simplex_handle previous = filtration[key - 1];
+      BOOST_CHECK(st.filtration(previous) <= st.filtration(sh));
+      BOOST_CHECK(st.filtration(previous) < st.filtration(sh) || st.dimension(previous) <= st.dimension(sh));
+    }
+    st.assign_key(sh, key++);
+  }
+  // The faces of a simplex are before it
+  for (auto sh : filtration)
+    for (auto b_sh : st.boundary_simplex_range(sh))
+      BOOST_CHECK(st.key(b_sh) < st.key(sh));
+}
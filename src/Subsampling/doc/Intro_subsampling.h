@@ -40,6 +40,11 @@ namespace subsampling {
  * starting with a random point.
  *
  * \include Subsampling/example_choose_n_farthest_points.cpp
+ *
+ * When the distance satisfies the triangle inequality, `choose_n_farthest_points_metric` computes the same landmarks
+ * and distances from a distance function. It keeps the points grouped by nearest landmark and only compares a new
+ * landmark to the groups it may split, found from a tree of the landmarks, and updates these groups in parallel with
+ * TBB. It is used by `Gudhi::rips_complex::Sparse_rips_complex`.
  * 
  * \section randompointexamples Example: pick_n_random_points
  *
@@ -15,10 +15,19 @@
 
 #include <gudhi/Null_output_iterator.h>
 
+#ifdef GUDHI_USE_TBB
+#include <tbb/parallel_for.h>
+#endif
+
 #include <iterator>
 #include <vector>
 #include <random>
 #include <limits>  // for numeric_limits<>
+#include <queue>
+#include <tuple>
+#include <utility>  // for std::pair
+#include <type_traits>  // for std::decay
+#include <cstddef>
 
 namespace Gudhi {
 
@@ -114,6 +123,201 @@ void choose_n_farthest_points(Kernel const &k,
   }
 }
 
+/**
+ *  \ingroup subsampling
+ *  \brief Same subsampling as `choose_n_farthest_points`, for a distance that satisfies the triangle inequality,
+ *  which is used to only compute the distances between the new landmark and the points that may get closer to it.
+ *  \tparam Distance A function object that takes two points of `input_pts` and returns their distance.
+ *  \tparam Point_range Random access range of points.
+ *  \tparam PointOutputIterator Output iterator whose value type is the value type of Point_range.
+ *  \tparam DistanceOutputIterator Output iterator for distances.
+ *  \details The landmarks and the distances are the same as the ones of `choose_n_farthest_points` with a kernel
+ *  whose `Squared_distance_d` is `dist`, including the choice of the smallest index among the farthest points.
+ *
+ *  Every point is stored with its distance in the cell of its nearest landmark. When a landmark is added, the only
+ *  cells where a point can get closer to it are the ones of the landmarks at distance less than twice the radius of
+ *  their cell. The landmarks form a tree, where the parent of a landmark is the one in whose cell it was chosen,
+ *  and every landmark stores an upper bound on the distance to its descendants, so that these cells are found
+ *  without computing the distance to all the landmarks. With TBB, the cells are updated in parallel.
+ * @param[in] dist The distance function.
+ * @param[in] input_pts Const reference to the input points.
+ * @param[in] final_size The size of the subsample to compute.
+ * @param[in] starting_point The seed in the farthest point algorithm.
+ * @param[out] output_it The output iterator for points.
+ * @param[out] dist_it The optional output iterator for distances.
+ */
+template < typename Distance,
+typename Point_range,
+typename PointOutputIterator,
+typename DistanceOutputIterator = Null_output_iterator>
+void choose_n_farthest_points_metric(Distance dist,
+                                     Point_range const &input_pts,
+                                     std::size_t final_size,
+                                     std::size_t starting_point,
+                                     PointOutputIterator output_it,
+                                     DistanceOutputIterator dist_it = {}) {
+  std::size_t nb_points = boost::size(input_pts);
+  if (final_size > nb_points)
+    final_size = nb_points;
+
+  // Tests to the limit
+  if (final_size < 1)
+    return;
+
+  if (starting_point == random_starting_point) {
+    // Choose randomly the first landmark
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<std::size_t> dis(0, nb_points - 1);
+    starting_point = dis(gen);
+  }
+
+  auto point = [&](std::size_t i) -> decltype(*std::begin(input_pts)) { return *(std::begin(input_pts) + i); };
+  typedef typename std::decay<decltype(dist(point(0), point(0)))>::type FT;
+  const FT infty = std::numeric_limits<FT>::infinity();
+  // The triangle inequality may not hold exactly for rounded distances, prune with a margin.
+  const FT margin = 1 + 16 * std::numeric_limits<FT>::epsilon();
+
+  struct Landmark {
+    std::size_t point;
+    std::size_t parent;
+    FT distance_to_parent;
+    // Upper bound on the distance to the descendants in the tree
+    FT subtree_radius;
+    std::vector<std::size_t> children;
+    // Points whose nearest landmark is this one, with their distance to it
+    std::vector<std::pair<std::size_t, FT>> cell;
+    FT cell_radius;
+    std::size_t farthest;
+  };
+  std::vector<Landmark> landmarks;
+  landmarks.reserve(final_size);
+  // Compares cells by radius, and by decreasing index of the farthest point for equal radii.
+  typedef std::tuple<FT, std::size_t, std::size_t> Cell_entry;  // radius, farthest point, landmark
+  auto compare = [](const Cell_entry& a, const Cell_entry& b) {
+    return std::get<0>(a) < std::get<0>(b) || (std::get<0>(a) == std::get<0>(b) && std::get<1>(a) > std::get<1>(b));
+  };
+  // Entries are not removed when the cell radius decreases, the outdated ones are skipped when they reach the top.
+  std::priority_queue<Cell_entry, std::vector<Cell_entry>, decltype(compare)> cells_by_radius(compare);
+
+  auto update_farthest = [&](Landmark& landmark) {
+    landmark.cell_radius = 0;
+    landmark.farthest = landmark.point;
+    for (auto&& p : landmark.cell) {
+      if (p.second > landmark.cell_radius || (p.second == landmark.cell_radius && p.first < landmark.farthest)) {
+        landmark.cell_radius = p.second;
+        landmark.farthest = p.first;
+      }
+    }
+  };
+  auto push_cell = [&](std::size_t l) {
+    if (landmarks[l].cell_radius > 0)
+      cells_by_radius.emplace(landmarks[l].cell_radius, landmarks[l].farthest, l);
+  };
+
+  // The first landmark
+  *output_it++ = point(starting_point);
+  *dist_it++ = infty;
+  landmarks.push_back(Landmark{starting_point, starting_point, 0, 0, {}, {}, 0, starting_point});
+  {
+    std::vector<FT> distances(nb_points);
+    auto compute_distance = [&](std::size_t i) { distances[i] = dist(point(i), point(starting_point)); };
+#ifdef GUDHI_USE_TBB
+    tbb::parallel_for(std::size_t(0), nb_points, compute_distance);
+#else
+    for (std::size_t i = 0; i < nb_points; ++i) compute_distance(i);
+#endif
+    landmarks[0].cell.reserve(nb_points - 1);
+    for (std::size_t i = 0; i < nb_points; ++i)
+      if (i != starting_point) landmarks[0].cell.emplace_back(i, distances[i]);
+  }
+  update_farthest(landmarks[0]);
+  push_cell(0);
+
+  std::vector<std::size_t> affected;
+  std::vector<std::size_t> to_visit;
+  std::vector<std::vector<std::pair<std::size_t, FT>>> moved;
+  for (std::size_t current_number_of_landmarks = 1; current_number_of_landmarks != final_size;
+       current_number_of_landmarks++) {
+    // Skip the outdated entries
+    while (!cells_by_radius.empty()) {
+      const Cell_entry& top = cells_by_radius.top();
+      const Landmark& landmark = landmarks[std::get<2>(top)];
+      if (landmark.cell_radius == std::get<0>(top) && landmark.farthest == std::get<1>(top)) break;
+      cells_by_radius.pop();
+    }
+    if (cells_by_radius.empty()) {
+      // As in choose_n_farthest_points, when no point is at a positive distance of the landmarks, the last one is
+      // repeated.
+      *output_it++ = point(landmarks.back().point);
+      *dist_it++ = 0;
+      continue;
+    }
+    const FT radius = std::get<0>(cells_by_radius.top());
+    const std::size_t parent = std::get<2>(cells_by_radius.top());
+    const std::size_t new_point = std::get<1>(cells_by_radius.top());
+    cells_by_radius.pop();
+    *output_it++ = point(new_point);
+    *dist_it++ = radius;
+
+    // Find the cells where a point may get closer to the new landmark. As the cell radius of every landmark is at most
+    // radius, a subtree can be skipped if its root is farther than its subtree radius plus 2 * radius.
+    affected.clear();
+    to_visit.assign(1, 0);
+    while (!to_visit.empty()) {
+      Landmark& landmark = landmarks[to_visit.back()];
+      to_visit.pop_back();
+      FT d = dist(point(landmark.point), point(new_point));
+      if (d < 2 * landmark.cell_radius * margin)
+        affected.push_back(&landmark - landmarks.data());
+      if (d < (landmark.subtree_radius + 2 * radius) * margin)
+        to_visit.insert(to_visit.end(), landmark.children.begin(), landmark.children.end());
+    }
+
+    // Move the points that get closer to the new landmark
+    moved.resize(affected.size());
+    auto update_cell = [&](std::size_t i) {
+      Landmark& landmark = landmarks[affected[i]];
+      moved[i].clear();
+      std::size_t kept = 0;
+      for (auto&& p : landmark.cell) {
+        if (p.first == new_point) continue;
+        FT d = dist(point(p.first), point(new_point));
+        if (d < p.second)
+          moved[i].emplace_back(p.first, d);
+        else
+          landmark.cell[kept++] = p;
+      }
+      landmark.cell.resize(kept);
+      update_farthest(landmark);
+    };
+#ifdef GUDHI_USE_TBB
+    tbb::parallel_for(std::size_t(0), affected.size(), update_cell);
+#else
+    for (std::size_t i = 0; i < affected.size(); ++i) update_cell(i);
+#endif
+
+    std::size_t l = landmarks.size();
+    landmarks.push_back(Landmark{new_point, parent, radius, 0, {}, {}, 0, new_point});
+    for (std::size_t i = 0; i < affected.size(); ++i) {
+      landmarks[l].cell.insert(landmarks[l].cell.end(), moved[i].begin(), moved[i].end());
+      push_cell(affected[i]);
+    }
+    update_farthest(landmarks[l]);
+    push_cell(l);
+
+    // Insert the new landmark in the tree, and update the bounds of its ancestors
+    landmarks[parent].children.push_back(l);
+    FT bound = radius;
+    for (std::size_t ancestor = parent; landmarks[ancestor].subtree_radius < bound;
+         ancestor = landmarks[ancestor].parent) {
+      landmarks[ancestor].subtree_radius = bound;
+      if (ancestor == 0) break;
+      bound += landmarks[ancestor].distance_to_parent;
+    }
+  }
+}
+
 }  // namespace subsampling
 
 }  // namespace Gudhi
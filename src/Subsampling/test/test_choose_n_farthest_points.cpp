@@ -20,6 +20,8 @@
 #include <gudhi/choose_n_farthest_points.h>
 #include <vector>
 #include <iterator>
+#include <random>
+#include <cmath>  // for std::sqrt
 
 #include <CGAL/Epick_d.h>
 
@@ -100,3 +102,41 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(test_choose_farthest_point_limits, Kernel, list_of
   BOOST_CHECK(distances[1] == 1);
   landmarks.clear(); distances.clear();
 }
+
+BOOST_AUTO_TEST_CASE(test_choose_farthest_point_metric) {
+  std::vector< Point_d > points;
+  // Grid points, with many points at the same distance, and random points
+  for (FT i = 0; i < 5; i += 1.0)
+    for (FT j = 0; j < 5; j += 1.0)
+      for (FT k = 0; k < 5; k += 1.0) {
+        std::vector<FT> point({i, j, k});
+        points.push_back(Point_d(point.begin(), point.end()));
+      }
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<FT> dis(0, 4);
+  for (int i = 0; i < 500; ++i) {
+    std::vector<FT> point({dis(gen), dis(gen), dis(gen)});
+    points.push_back(Point_d(point.begin(), point.end()));
+  }
+  // Duplicate points
+  for (int i = 0; i < 10; ++i) points.push_back(points[i * 7]);
+
+  K k;
+  auto dist = [&k](const Point_d& p, const Point_d& q) { return std::sqrt(k.squared_distance_d_object()(p, q)); };
+  struct Distance_kernel {
+    typedef decltype(dist) Squared_distance_d;
+    Squared_distance_d squared_distance_d_object() const { return d; }
+    Squared_distance_d d;
+  } kernel{dist};
+
+  std::vector< Point_d > landmarks, metric_landmarks;
+  std::vector< FT > distances, metric_distances;
+  // Choose all the points, so that the last landmark is repeated for the duplicates as by choose_n_farthest_points
+  Gudhi::subsampling::choose_n_farthest_points(kernel, points, -1, 3, std::back_inserter(landmarks),
+                                               std::back_inserter(distances));
+  Gudhi::subsampling::choose_n_farthest_points_metric(dist, points, -1, 3,
+                                                      std::back_inserter(metric_landmarks),
+                                                      std::back_inserter(metric_distances));
+  BOOST_CHECK(landmarks == metric_landmarks);
+  BOOST_CHECK(distances == metric_distances);
+}
@@ -124,6 +124,7 @@ class XML_perf_data {
     subelements.push_back("Final_num_inconsistent_local_tr");
     subelements.push_back("Init_time");
     subelements.push_back("Comput_time");
+    subelements.push_back("Simplex_tree_export_time");
     subelements.push_back("Perturb_successful");
     subelements.push_back("Perturb_time");
     subelements.push_back("Perturb_steps");
@@ -377,9 +378,11 @@ void make_tc(std::vector<Point> &points,
   Simplex_set inconsistent_simplices;
   max_dim = tc.create_complex(complex, true, false, 2, &inconsistent_simplices);
 
-  // TODO(CJ): TEST
+  t.begin();
   Gudhi::Simplex_tree<> stree;
   tc.create_complex(stree, true, false);
+  t.end();
+  double stree_export_time = t.num_seconds();
   // std::cerr << stree;
 
   t.begin();
@@ -524,6 +527,8 @@ void make_tc(std::vector<Point> &points,
       << "  * Tangential complex: " << init_time + computation_time << "\n"
       << "    - Init + kd-tree = " << init_time << "\n"
       << "    - TC computation = " << computation_time << "\n"
+      << "  * Export to Simplex_tree: " << stree_export_time
+      << " (" << stree.num_simplices() << " simplices)\n"
       << "  * Export to OFF (before perturb): " << export_before_time << "\n"
       << "  * Fix inconsistencies 1: " << perturb_time
       << " (" << num_perturb_steps << " steps) ==> "
@@ -538,6 +543,7 @@ void make_tc(std::vector<Point> &points,
   //===========================================================================
   GUDHI_TC_SET_PERFORMANCE_DATA("Init_time", init_time);
   GUDHI_TC_SET_PERFORMANCE_DATA("Comput_time", computation_time);
+  GUDHI_TC_SET_PERFORMANCE_DATA("Simplex_tree_export_time", stree_export_time);
   GUDHI_TC_SET_PERFORMANCE_DATA("Perturb_successful",
                                 (perturb_success ? 1 : 0));
   GUDHI_TC_SET_PERFORMANCE_DATA("Perturb_time", perturb_time);
@@ -60,6 +60,7 @@
 #ifdef GUDHI_USE_TBB
 #include <tbb/parallel_for.h>
 #include <tbb/combinable.h>
+#include <tbb/parallel_sort.h>
 #include <mutex>
 #endif
 
@@ -622,31 +623,55 @@ class Tangential_complex {
 #endif
 
     int max_dim = -1;
-
-    // For each triangulation
-    for (std::size_t idx = 0; idx < m_points.size(); ++idx) {
+    bool check_consistency = !export_inconsistent_simplices || p_inconsistent_simplices;
+    // A simplex is in the stars of several of its vertices: the simplices of all the stars are collected with their
+    // consistency, in parallel, then sorted to remove the duplicates and inserted in lexicographical order.
+    std::vector<std::pair<Simplex, bool> > simplices;
+    auto collect_star = [&](std::size_t idx, std::vector<std::pair<Simplex, bool> > &star_simplices, int &star_max_dim) {
       // For each cell of the star
-      Star::const_iterator it_inc_simplex = m_stars[idx].begin();
-      Star::const_iterator it_inc_simplex_end = m_stars[idx].end();
-      for (; it_inc_simplex != it_inc_simplex_end; ++it_inc_simplex) {
-        Simplex c = *it_inc_simplex;
-
+      for (Incident_simplex const &inc_simplex : m_stars[idx]) {
         // Don't export infinite cells
-        if (!export_infinite_simplices && is_infinite(c)) continue;
+        if (!export_infinite_simplices && is_infinite(inc_simplex)) continue;
 
-        if (static_cast<int>(c.size()) > max_dim) max_dim = static_cast<int>(c.size());
+        if (static_cast<int>(inc_simplex.size()) > star_max_dim) star_max_dim = static_cast<int>(inc_simplex.size());
+        Simplex c = inc_simplex;
         // Add the missing center vertex
         c.insert(idx);
 
-        if (!export_inconsistent_simplices && !is_simplex_consistent(c)) continue;
+        bool consistent = !check_consistency || is_simplex_consistent(c);
+        if (!export_inconsistent_simplices && !consistent) continue;
+        star_simplices.emplace_back(std::move(c), consistent);
+      }
+    };
 
-        // Try to insert the simplex
-        bool inserted = tree.insert_simplex_and_subfaces(c).second;
+#ifdef GUDHI_USE_TBB
+    if (boost::is_convertible<Concurrency_tag, CGAL::Parallel_tag>::value) {
+      tbb::combinable<std::vector<std::pair<Simplex, bool> > > tls_simplices;
+      tbb::combinable<int> tls_max_dim([]() { return -1; });
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, m_points.size()), [&](const tbb::blocked_range<size_t> &r) {
+        for (size_t idx = r.begin(); idx != r.end(); ++idx) collect_star(idx, tls_simplices.local(), tls_max_dim.local());
+      });
+      tls_simplices.combine_each([&](std::vector<std::pair<Simplex, bool> > const &v) {
+        simplices.insert(simplices.end(), v.begin(), v.end());
+      });
+      max_dim = tls_max_dim.combine([](int a, int b) { return (std::max)(a, b); });
+      tbb::parallel_sort(simplices.begin(), simplices.end());
+    } else
+#endif  // GUDHI_USE_TBB
+    {
+      // For each triangulation
+      for (std::size_t idx = 0; idx < m_points.size(); ++idx) collect_star(idx, simplices, max_dim);
+      std::sort(simplices.begin(), simplices.end());
+    }
+    simplices.erase(std::unique(simplices.begin(), simplices.end()), simplices.end());
 
-        // Inconsistent?
-        if (p_inconsistent_simplices && inserted && !is_simplex_consistent(c)) {
-          p_inconsistent_simplices->insert(c);
-        }
+    for (auto const &c : simplices) {
+      // Try to insert the simplex
+      bool inserted = tree.insert_simplex_and_subfaces(c.first).second;
+
+      // Inconsistent?
+      if (p_inconsistent_simplices && inserted && !c.second) {
+        p_inconsistent_simplices->insert(c.first);
       }
     }
 
@@ -57,6 +57,18 @@
 
    The constructors take on the steps 1 and 2, while the function 'create_complex' executes the step 3.
 
+   The function 'parallel_create_complex' builds the same complex with the witnesses processed in parallel when TBB is
+   available. For the weak witness complex, the simplices of each dimension are collected per thread from the
+   simplices of lower dimensions, merged with their minimal filtration values, and inserted at once. For the strong
+   witness complex, each thread builds its own complex, and these complexes are merged.
+
+   When the relaxation and the dimension of the weak witness complex are bounded in advance, the function
+   Gudhi::witness_complex::compute_nearest_landmark_table replaces the steps 1 and 2. It computes, in parallel when TBB
+   is available, only the nearest landmarks of each witness that the step 3 reads, in a
+   Gudhi::witness_complex::Compact_nearest_landmark_table stored in one flat array. This table is given as input to
+   Gudhi::witness_complex::Witness_complex, which builds the same complex with much less memory than the Euclidean
+   version, that keeps a nearest neighbor search and a list of nearest landmarks per witness.
+
    \section witnessexample1 Example 1: Constructing weak relaxed witness complex from an off file
 
    Let's start with a simple example, which reads an off point file and computes a weak witness complex.
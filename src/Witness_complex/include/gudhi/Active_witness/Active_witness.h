@@ -12,6 +12,9 @@
 #define ACTIVE_WITNESS_ACTIVE_WITNESS_H_
 
 #include <gudhi/Active_witness/Active_witness_iterator.h>
+
+#include <boost/range/iterator_range.hpp>
+
 #include <list>
 
 namespace Gudhi {
@@ -49,6 +52,30 @@ class Active_witness {
   }
 };
 
+  /* \brief Specialization for nearest landmarks stored contiguously, as in a `Compact_nearest_landmark_table`.
+   *  \details They are all computed already, and read in place instead of being copied in a list.
+  */
+template< typename Id_distance_pair >
+class Active_witness<Id_distance_pair, boost::iterator_range<const Id_distance_pair*>> {
+ public:
+  typedef boost::iterator_range<const Id_distance_pair*> INS_range;
+  typedef const Id_distance_pair* iterator;
+
+  INS_range search_range_;
+
+  Active_witness(const INS_range& search_range)
+    : search_range_(search_range) {
+  }
+
+  iterator begin() const {
+    return search_range_.begin();
+  }
+
+  iterator end() const {
+    return search_range_.end();
+  }
+};
+
 }  // namespace witness_complex
 }  // namespace Gudhi
 
@@ -13,6 +13,7 @@
 #define EUCLIDEAN_WITNESS_COMPLEX_H_
 
 #include <gudhi/Witness_complex.h>
+#include <gudhi/Witness_complex/Compact_nearest_landmark_table.h>
 #include <gudhi/Active_witness/Active_witness.h>
 #include <gudhi/Kd_tree_search.h>
 
@@ -24,6 +25,7 @@
 #include <vector>
 #include <list>
 #include <limits>
+#include <cstddef>  // for std::size_t
 
 // Make compilation fail - required for external projects - https://github.com/GUDHI/gudhi-devel/issues/10
 #if CGAL_VERSION_NR < 1041101000
@@ -101,6 +103,37 @@ class Euclidean_witness_complex
   //@}
 };
 
+/**
+ * \brief Computes the nearest landmarks of the witnesses in Euclidean space that the construction of a (weak) witness
+ *        complex of relaxation at most 'max_alpha_square' and dimension at most 'limit_dimension' reads.
+ * \ingroup witness_complex
+ *
+ * \details Unlike Euclidean_witness_complex, which keeps a nearest neighbor search per witness during the
+ * construction, the nearest landmarks are computed beforehand, in parallel if TBB is available, and stored in a
+ * Compact_nearest_landmark_table, from which a Witness_complex<Compact_nearest_landmark_table> is constructed.
+ * Both ranges should have value_type Kernel_::Point_d.
+ *
+ * \tparam Kernel_ requires a <a target="_blank"
+ * href="http://doc.cgal.org/latest/Kernel_d/classCGAL_1_1Epick__d.html">CGAL::Epick_d</a> class.
+ */
+template< class Kernel_,
+          typename LandmarkRange,
+          typename WitnessRange >
+Compact_nearest_landmark_table compute_nearest_landmark_table(const LandmarkRange & landmarks,
+                                                              const WitnessRange &  witnesses,
+                                                              double max_alpha_square,
+                                                              std::size_t limit_dimension) {
+  typedef typename Kernel_::Point_d Point_d;
+  typedef std::vector<Point_d> Point_range;
+  Point_range landmark_points(std::begin(landmarks), std::end(landmarks));
+  Gudhi::spatial_searching::Kd_tree_search<Kernel_, Point_range> landmark_tree(landmark_points);
+  return Compact_nearest_landmark_table(witnesses,
+                                        [&landmark_tree](const Point_d& w) {
+                                          return landmark_tree.incremental_nearest_neighbors(w);
+                                        },
+                                        max_alpha_square, limit_dimension);
+}
+
 }  // namespace witness_complex
 
 }  // namespace Gudhi
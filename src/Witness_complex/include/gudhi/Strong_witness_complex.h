@@ -13,10 +13,16 @@
 
 #include <gudhi/Active_witness/Active_witness.h>
 
+#ifdef GUDHI_USE_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/enumerable_thread_specific.h>
+#endif
+
 #include <utility>
 #include <vector>
 #include <list>
 #include <limits>
+#include <cstddef>  // for std::size_t
 
 namespace Gudhi {
 
@@ -87,7 +93,62 @@ class Strong_witness_complex {
   bool create_complex(SimplicialComplexForWitness& complex,
                       double  max_alpha_square,
                       Landmark_id limit_dimension = std::numeric_limits<Landmark_id>::max()) const {
-    Landmark_id complex_dim = 0;
+    if (!can_create_complex(complex, max_alpha_square))
+      return false;
+    auto insert_simplex_and_subfaces = [&complex](const typeVectorVertex& simplex, double filtration_value) {
+      complex.insert_simplex_and_subfaces(simplex, filtration_value);
+    };
+    for (auto&& w : nearest_landmark_table_)
+      add_all_simplices_of_witness(w, max_alpha_square, limit_dimension, insert_simplex_and_subfaces);
+    return true;
+  }
+
+  /** \brief Same as `create_complex()`, but if TBB is available, the witnesses are processed in parallel.
+   *  \details Each thread inserts the simplices of its witnesses in its own complex, and these complexes are then
+   *         merged, a simplex in several of them getting its minimal filtration value. The resulting complex is
+   *         identical to the one of `create_complex()`.
+   *
+   *  SimplicialComplexForWitness must be default constructible and move assignable, and provide
+   *  `complex_simplex_range`, `simplex_vertex_range` and `filtration`, as `Simplex_tree`.
+   */
+  template < typename SimplicialComplexForWitness >
+  bool parallel_create_complex(SimplicialComplexForWitness& complex,
+                               double  max_alpha_square,
+                               Landmark_id limit_dimension = std::numeric_limits<Landmark_id>::max()) const {
+#ifdef GUDHI_USE_TBB
+    if (!can_create_complex(complex, max_alpha_square))
+      return false;
+    tbb::enumerable_thread_specific<SimplicialComplexForWitness> local_complexes;
+    tbb::parallel_for(std::size_t(0), nearest_landmark_table_.size(), [&](std::size_t i) {
+      SimplicialComplexForWitness& local_complex = local_complexes.local();
+      auto insert_simplex_and_subfaces = [&local_complex](const typeVectorVertex& simplex, double filtration_value) {
+        local_complex.insert_simplex_and_subfaces(simplex, filtration_value);
+      };
+      add_all_simplices_of_witness(nearest_landmark_table_[i], max_alpha_square, limit_dimension,
+                                   insert_simplex_and_subfaces);
+    });
+    bool is_first = true;
+    for (auto& local_complex : local_complexes) {
+      if (is_first) {
+        complex = std::move(local_complex);
+        is_first = false;
+        continue;
+      }
+      // The faces of a simplex are all in local_complex, with a lower filtration value.
+      for (auto sh : local_complex.complex_simplex_range())
+        complex.insert_simplex(local_complex.simplex_vertex_range(sh), local_complex.filtration(sh));
+    }
+    return true;
+#else
+    return create_complex(complex, max_alpha_square, limit_dimension);
+#endif
+  }
+
+  //@}
+
+ private:
+  template < typename SimplicialComplexForWitness >
+  bool can_create_complex(SimplicialComplexForWitness& complex, double max_alpha_square) const {
     if (complex.num_vertices() > 0) {
       std::cerr << "Strong witness complex cannot create complex - complex is not empty.\n";
       return false;
@@ -97,47 +158,50 @@ class Strong_witness_complex {
                 << "non-negative.\n";
       return false;
     }
-    for (auto w : nearest_landmark_table_) {
-      ActiveWitness aw(w);
-      typeVectorVertex simplex;
-      typename ActiveWitness::iterator aw_it = aw.begin();
-      float lim_dist2 = aw.begin()->second + max_alpha_square;
-      while ((Landmark_id)simplex.size() <= limit_dimension && aw_it != aw.end() && aw_it->second < lim_dist2) {
-        simplex.push_back(aw_it->first);
-        complex.insert_simplex_and_subfaces(simplex, aw_it->second - aw.begin()->second);
-        aw_it++;
-      }
-      // continue inserting limD-faces of the following simplices
-      typeVectorVertex& vertices = simplex;  // 'simplex' now will be called vertices
-      while (aw_it != aw.end() && aw_it->second < lim_dist2) {
-        typeVectorVertex facet = {};
-        add_all_faces_of_dimension(limit_dimension, vertices, vertices.begin(), aw_it,
-                                   aw_it->second - aw.begin()->second, facet, complex);
-        vertices.push_back(aw_it->first);
-        aw_it++;
-      }
-      if ((Landmark_id)simplex.size() - 1 > complex_dim)
-        complex_dim = simplex.size() - 1;
-    }
     return true;
   }
 
-  //@}
+  /* \brief Passes all the simplices witnessed by the witness w to insert_simplex_and_subfaces, with their filtration
+   * value. Their faces are meant to be inserted too.
+   */
+  template < typename Insert_simplex_and_subfaces >
+  void add_all_simplices_of_witness(const Nearest_landmark_range& w,
+                                    double max_alpha_square,
+                                    Landmark_id limit_dimension,
+                                    Insert_simplex_and_subfaces& insert_simplex_and_subfaces) const {
+    ActiveWitness aw(w);
+    typeVectorVertex simplex;
+    typename ActiveWitness::iterator aw_it = aw.begin();
+    float lim_dist2 = aw.begin()->second + max_alpha_square;
+    while ((Landmark_id)simplex.size() <= limit_dimension && aw_it != aw.end() && aw_it->second < lim_dist2) {
+      simplex.push_back(aw_it->first);
+      insert_simplex_and_subfaces(simplex, aw_it->second - aw.begin()->second);
+      aw_it++;
+    }
+    // continue inserting limD-faces of the following simplices
+    typeVectorVertex& vertices = simplex;  // 'simplex' now will be called vertices
+    while (aw_it != aw.end() && aw_it->second < lim_dist2) {
+      typeVectorVertex facet = {};
+      add_all_faces_of_dimension(limit_dimension, vertices, vertices.begin(), aw_it,
+                                 aw_it->second - aw.begin()->second, facet, insert_simplex_and_subfaces);
+      vertices.push_back(aw_it->first);
+      aw_it++;
+    }
+  }
 
- private:
     /* \brief Adds recursively all the faces of a certain dimension dim-1 witnessed by the same witness.
      * Iterator is needed to know until how far we can take landmarks to form simplexes.
      * simplex is the prefix of the simplexes to insert.
      * The landmark pointed by aw_it is added to all formed simplices.
      */
-  template < typename SimplicialComplexForWitness >
+  template < typename Insert_simplex_and_subfaces >
   void add_all_faces_of_dimension(Landmark_id dim,
                                   typeVectorVertex& vertices,
                                   typename typeVectorVertex::iterator curr_it,
                                   typename ActiveWitness::iterator aw_it,
                                   double filtration_value,
                                   typeVectorVertex& simplex,
-                                  SimplicialComplexForWitness& sc) const {
+                                  Insert_simplex_and_subfaces& insert_simplex_and_subfaces) const {
     if (dim > 0) {
       while (curr_it != vertices.end()) {
         simplex.push_back(*curr_it);
@@ -148,7 +212,7 @@ class Strong_witness_complex {
                                    aw_it,
                                    filtration_value,
                                    simplex,
-                                   sc);
+                                   insert_simplex_and_subfaces);
         simplex.pop_back();
         add_all_faces_of_dimension(dim,
                                    vertices,
@@ -156,11 +220,11 @@ class Strong_witness_complex {
                                    aw_it,
                                    filtration_value,
                                    simplex,
-                                   sc);
+                                   insert_simplex_and_subfaces);
       }
     } else if (dim == 0) {
       simplex.push_back(aw_it->first);
-      sc.insert_simplex_and_subfaces(simplex, filtration_value);
+      insert_simplex_and_subfaces(simplex, filtration_value);
       simplex.pop_back();
     }
   }
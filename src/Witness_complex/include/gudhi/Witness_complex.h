@@ -13,11 +13,18 @@
 
 #include <gudhi/Active_witness/Active_witness.h>
 #include <gudhi/Witness_complex/all_faces_in.h>
+#include <gudhi/Witness_complex/Simplex_buffer.h>
+
+#ifdef GUDHI_USE_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/enumerable_thread_specific.h>
+#endif
 
 #include <utility>
 #include <vector>
 #include <list>
 #include <limits>
+#include <cstddef>  // for std::size_t
 
 namespace Gudhi {
 
@@ -89,14 +96,11 @@ class Witness_complex {
   bool create_complex(SimplicialComplexForWitness& complex,
                       double  max_alpha_square,
                       std::size_t limit_dimension = std::numeric_limits<std::size_t>::max()) const {
-    if (complex.num_vertices() > 0) {
-      std::cerr << "Witness complex cannot create complex - complex is not empty.\n";
+    if (!can_create_complex(complex, max_alpha_square))
       return false;
-    }
-    if (max_alpha_square < 0) {
-      std::cerr << "Witness complex cannot create complex - squared relaxation parameter must be non-negative.\n";
-      return false;
-    }
+    auto insert_simplex = [&complex](const std::vector<Landmark_id>& simplex, double filtration_value) {
+      complex.insert_simplex(simplex, filtration_value);
+    };
     ActiveWitnessList active_witnesses;
     Landmark_id k = 0; /* current dimension in iterative construction */
     for (auto&& w : nearest_landmark_table_)
@@ -112,7 +116,8 @@ class Witness_complex {
                                              aw_it->begin(),
                                              simplex,
                                              complex,
-                                             aw_it->end());
+                                             aw_it->end(),
+                                             insert_simplex);
         assert(simplex.empty());
         if (!ok)
           active_witnesses.erase(aw_it++);  // First increase the iterator and then erase the previous element
@@ -124,22 +129,100 @@ class Witness_complex {
     return true;
   }
 
+  /** \brief Same as `create_complex()`, but if TBB is available, the witnesses are processed in parallel.
+   *  \details The simplices of each dimension are computed concurrently from the simplices of lower dimensions, as
+   *         these are not modified meanwhile, and collected in a buffer per thread. The copies of a simplex
+   *         witnessed by several witnesses are then merged with their minimal filtration value, and the simplices
+   *         are inserted at once. The resulting complex is identical to the one of `create_complex()`.
+   *
+   *  `find` and `filtration` of SimplicialComplexForWitness must be callable concurrently, as for `Simplex_tree`.
+   */
+  template < typename SimplicialComplexForWitness >
+  bool parallel_create_complex(SimplicialComplexForWitness& complex,
+                               double  max_alpha_square,
+                               std::size_t limit_dimension = std::numeric_limits<std::size_t>::max()) const {
+    if (!can_create_complex(complex, max_alpha_square))
+      return false;
+    ActiveWitnessList active_witnesses;
+    Landmark_id k = 0; /* current dimension in iterative construction */
+    for (auto&& w : nearest_landmark_table_)
+      active_witnesses.emplace_back(w);
+    std::vector<typename ActiveWitnessList::iterator> witnesses;
+    std::vector<char> is_active;
+    while (!active_witnesses.empty() && k <= limit_dimension) {
+      witnesses.clear();
+      for (auto aw_it = active_witnesses.begin(); aw_it != active_witnesses.end(); ++aw_it)
+        witnesses.push_back(aw_it);
+      is_active.assign(witnesses.size(), false);
+      auto add_faces_of_witness = [&](std::size_t i, Simplex_buffer<Landmark_id>& buffer) {
+        std::vector<Landmark_id> simplex;
+        simplex.reserve(k+1);
+        auto push_back = [&buffer](const std::vector<Landmark_id>& simplex, double filtration_value) {
+          buffer.push_back(simplex, filtration_value);
+        };
+        is_active[i] = add_all_faces_of_dimension(k,
+                                                  max_alpha_square,
+                                                  std::numeric_limits<double>::infinity(),
+                                                  witnesses[i]->begin(),
+                                                  simplex,
+                                                  complex,
+                                                  witnesses[i]->end(),
+                                                  push_back);
+      };
+      Simplex_buffer<Landmark_id> simplices;
+#ifdef GUDHI_USE_TBB
+      tbb::enumerable_thread_specific<Simplex_buffer<Landmark_id>> buffers;
+      tbb::parallel_for(std::size_t(0), witnesses.size(), [&](std::size_t i) {
+        add_faces_of_witness(i, buffers.local());
+      });
+      for (auto& buffer : buffers)
+        simplices.splice(buffer);
+#else
+      for (std::size_t i = 0; i < witnesses.size(); ++i)
+        add_faces_of_witness(i, simplices);
+#endif
+      simplices.for_each_distinct_simplex([&complex](const std::vector<Landmark_id>& simplex, double filtration_value) {
+        complex.insert_simplex(simplex, filtration_value);
+      });
+      for (std::size_t i = 0; i < witnesses.size(); ++i)
+        if (!is_active[i])
+          active_witnesses.erase(witnesses[i]);
+      k++;
+    }
+    return true;
+  }
+
   //@}
 
  private:
+  template < typename SimplicialComplexForWitness >
+  bool can_create_complex(SimplicialComplexForWitness& complex, double max_alpha_square) const {
+    if (complex.num_vertices() > 0) {
+      std::cerr << "Witness complex cannot create complex - complex is not empty.\n";
+      return false;
+    }
+    if (max_alpha_square < 0) {
+      std::cerr << "Witness complex cannot create complex - squared relaxation parameter must be non-negative.\n";
+      return false;
+    }
+    return true;
+  }
+
   /* \brief Adds recursively all the faces of a certain dimension dim witnessed by the same witness.
    * Iterator is needed to know until how far we can take landmarks to form simplexes.
    * simplex is the prefix of the simplexes to insert.
+   * The simplices of dimension dim are passed to insert_simplex, with their filtration value.
    * The output value indicates if the witness rests active or not.
    */
-  template < typename SimplicialComplexForWitness >
+  template < typename SimplicialComplexForWitness, typename Insert_simplex >
   bool add_all_faces_of_dimension(int dim,
                                   double alpha2,
                                   double norelax_dist2,
                                   typename ActiveWitness::iterator curr_l,
                                   std::vector<Landmark_id>& simplex,
                                   SimplicialComplexForWitness& sc,
-                                  typename ActiveWitness::iterator end) const {
+                                  typename ActiveWitness::iterator end,
+                                  Insert_simplex& insert_simplex) const {
     if (curr_l == end)
       return false;
     bool will_be_active = false;
@@ -155,7 +238,8 @@ class Witness_complex {
                                                       ++next_it,
                                                       simplex,
                                                       sc,
-                                                      end) || will_be_active;
+                                                      end,
+                                                      insert_simplex) || will_be_active;
         }
         assert(!simplex.empty());
         simplex.pop_back();
@@ -172,7 +256,7 @@ class Witness_complex {
           filtration_value = l_it->second - norelax_dist2;
         if (all_faces_in(simplex, &filtration_value, sc)) {
           will_be_active = true;
-          sc.insert_simplex(simplex, filtration_value);
+          insert_simplex(simplex, filtration_value);
         }
         assert(!simplex.empty());
         simplex.pop_back();
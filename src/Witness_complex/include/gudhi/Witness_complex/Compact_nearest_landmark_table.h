@@ -0,0 +1,160 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Clément Maria
+ *
+ *    Copyright (C) 2020 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef WITNESS_COMPLEX_COMPACT_NEAREST_LANDMARK_TABLE_H_
+#define WITNESS_COMPLEX_COMPACT_NEAREST_LANDMARK_TABLE_H_
+
+#include <boost/range/iterator_range.hpp>
+#include <boost/iterator/transform_iterator.hpp>
+#include <boost/iterator/counting_iterator.hpp>
+
+#ifdef GUDHI_USE_TBB
+#include <tbb/parallel_for.h>
+#endif
+
+#include <vector>
+#include <utility>  // for std::pair
+#include <iterator>  // for std::begin, std::end
+#include <cstddef>  // for std::size_t
+
+namespace Gudhi {
+
+namespace witness_complex {
+
+/**
+ * \class Compact_nearest_landmark_table
+ * \brief Table of the nearest landmarks of the witnesses, truncated to the landmarks the construction of a (weak)
+ * witness complex of bounded dimension and relaxation reads, and stored in one flat array.
+ * \ingroup witness_complex
+ *
+ * \details For each witness, the table keeps its `limit_dimension + 1` nearest landmarks, followed by the next ones
+ * whose squared distance is at most the squared distance to its `limit_dimension + 1`-th nearest landmark plus
+ * `max_alpha_square`. The landmarks that are not kept cannot be part of a simplex witnessed by this witness, nor
+ * change which simplices it witnesses, so `Witness_complex<Compact_nearest_landmark_table>::create_complex()` gives
+ * the same complex as with the complete table, for any relaxation up to `max_alpha_square` and any dimension up to
+ * `limit_dimension`.
+ *
+ * The witness complex refers to the nearest landmarks stored in the table, which must not be destroyed meanwhile.
+ */
+class Compact_nearest_landmark_table {
+ public:
+  /** \brief Landmark identifier and squared distance to the witness. */
+  typedef std::pair<std::size_t, double> Id_distance_pair;
+  /** \brief Nearest landmarks of a witness, sorted by increasing distance. */
+  typedef boost::iterator_range<const Id_distance_pair*> value_type;
+
+ private:
+  struct Nearest_landmarks_of_witness {
+    typedef value_type result_type;
+    const Compact_nearest_landmark_table* table;
+    value_type operator()(std::size_t witness) const { return (*table)[witness]; }
+  };
+
+ public:
+  /** \brief Iterator on the nearest landmarks of the witnesses, in the order of the witnesses. */
+  typedef boost::transform_iterator<Nearest_landmarks_of_witness, boost::counting_iterator<std::size_t>>
+      const_iterator;
+  typedef const_iterator iterator;
+
+  /**
+   *  \brief Computes the table of the witnesses of the range 'witnesses'.
+   *  \details The nearest landmarks of the witnesses are computed by batches, in parallel if TBB is available, and
+   *         read only as far as needed.
+   *  @param[in] witnesses Range of witnesses.
+   *  @param[in] nearest_landmarks Function which returns, for a witness, a range of pairs of all its nearest
+   *         landmarks and their squared distances, sorted by increasing distance, which may be computed incrementally
+   *         when it is iterated, as `Kd_tree_search::INS_range`. It must be callable concurrently.
+   *  @param[in] max_alpha_square Maximal squared relaxation parameter of the witness complexes to construct.
+   *  @param[in] limit_dimension Maximal dimension of the witness complexes to construct.
+   */
+  template <typename WitnessRange, typename NearestLandmarks>
+  Compact_nearest_landmark_table(const WitnessRange& witnesses,
+                                 NearestLandmarks&& nearest_landmarks,
+                                 double max_alpha_square,
+                                 std::size_t limit_dimension) {
+    typedef decltype(std::begin(witnesses)) Witness_iterator;
+    offsets_.push_back(0);
+    std::vector<Witness_iterator> batch;
+    std::vector<std::vector<Id_distance_pair>> rows(batch_size);
+    batch.reserve(batch_size);
+    auto compute_row = [&](std::size_t i) {
+      auto&& range = nearest_landmarks(*batch[i]);
+      truncate(range, max_alpha_square, limit_dimension, rows[i]);
+    };
+    for (auto w_it = std::begin(witnesses); w_it != std::end(witnesses);) {
+      batch.clear();
+      for (; w_it != std::end(witnesses) && batch.size() < batch_size; ++w_it)
+        batch.push_back(w_it);
+#ifdef GUDHI_USE_TBB
+      tbb::parallel_for(std::size_t(0), batch.size(), compute_row);
+#else
+      for (std::size_t i = 0; i < batch.size(); ++i)
+        compute_row(i);
+#endif
+      for (std::size_t i = 0; i < batch.size(); ++i) {
+        landmarks_.insert(landmarks_.end(), rows[i].begin(), rows[i].end());
+        offsets_.push_back(landmarks_.size());
+      }
+    }
+    landmarks_.shrink_to_fit();
+  }
+
+  /** \brief Returns the number of witnesses. */
+  std::size_t size() const {
+    return offsets_.size() - 1;
+  }
+
+  /** \brief Returns the nearest landmarks of a witness. */
+  value_type operator[](std::size_t witness) const {
+    return value_type(landmarks_.data() + offsets_[witness], landmarks_.data() + offsets_[witness + 1]);
+  }
+
+  /** \brief Returns an iterator on the nearest landmarks of the first witness. */
+  const_iterator begin() const {
+    return const_iterator(boost::counting_iterator<std::size_t>(0), Nearest_landmarks_of_witness{this});
+  }
+
+  /** \brief Returns an iterator past the nearest landmarks of the last witness. */
+  const_iterator end() const {
+    return const_iterator(boost::counting_iterator<std::size_t>(size()), Nearest_landmarks_of_witness{this});
+  }
+
+ private:
+  // Number of witnesses whose nearest landmarks are computed together, before being appended to the table.
+  static const std::size_t batch_size = 1024;
+
+  /* \brief Copies in row the nearest landmarks of range that are kept in the table.
+   * The tests are those of `Witness_complex::add_all_faces_of_dimension`, with the largest possible non-relaxed
+   * distance, which is the distance to the `limit_dimension + 1`-th nearest landmark. */
+  template <typename NearestLandmarkRange>
+  static void truncate(NearestLandmarkRange& range, double max_alpha_square, std::size_t limit_dimension,
+                       std::vector<Id_distance_pair>& row) {
+    row.clear();
+    double norelax_dist2 = 0;
+    for (auto l_it = std::begin(range); l_it != std::end(range); ++l_it) {
+      auto const& landmark = *l_it;
+      if (row.size() > limit_dimension && landmark.second - max_alpha_square > norelax_dist2)
+        break;
+      row.emplace_back(landmark.first, landmark.second);
+      if (row.size() - 1 == limit_dimension)
+        norelax_dist2 = landmark.second;
+    }
+  }
+
+  // The nearest landmarks of witness i are landmarks_[offsets_[i]], ..., landmarks_[offsets_[i + 1] - 1].
+  std::vector<Id_distance_pair> landmarks_;
+  std::vector<std::size_t> offsets_;
+};
+
+}  // namespace witness_complex
+
+}  // namespace Gudhi
+
+#endif  // WITNESS_COMPLEX_COMPACT_NEAREST_LANDMARK_TABLE_H_
@@ -0,0 +1,132 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Clément Maria
+ *
+ *    Copyright (C) 2020 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef WITNESS_COMPLEX_SIMPLEX_BUFFER_H_
+#define WITNESS_COMPLEX_SIMPLEX_BUFFER_H_
+
+#include <vector>
+#include <array>
+#include <utility>  // for std::pair
+#include <type_traits>  // for std::integral_constant
+#include <algorithm>  // for std::sort, std::copy_n, std::lexicographical_compare, std::equal
+#include <iterator>  // for std::begin, std::end, std::distance
+#include <numeric>  // for std::iota
+#include <cstddef>  // for std::size_t
+
+namespace Gudhi {
+
+namespace witness_complex {
+
+/* \brief Simplices with their filtration values, stored dimension by dimension in flat arrays, to be inserted at
+ * once in a complex.
+ *
+ * A simplex may be added several times, as a simplex is witnessed by several witnesses: only its copy of minimal
+ * filtration value is inserted, which is the filtration value the complex keeps when all the copies are inserted.
+ */
+template<typename Vertex_handle>
+class Simplex_buffer {
+ public:
+  /* \brief Adds a simplex, whose vertices may be in any order. */
+  template<typename VertexRange>
+  void push_back(const VertexRange& simplex, double filtration) {
+    std::size_t dim = static_cast<std::size_t>(std::distance(std::begin(simplex), std::end(simplex))) - 1;
+    if (dim >= vertices_.size()) {
+      vertices_.resize(dim + 1);
+      filtrations_.resize(dim + 1);
+    }
+    auto first = vertices_[dim].insert(vertices_[dim].end(), std::begin(simplex), std::end(simplex));
+    std::sort(first, vertices_[dim].end());
+    filtrations_[dim].push_back(filtration);
+  }
+
+  /* \brief Moves the simplices of other at the end of this buffer. */
+  void splice(Simplex_buffer& other) {
+    if (other.vertices_.size() > vertices_.size()) {
+      vertices_.resize(other.vertices_.size());
+      filtrations_.resize(other.vertices_.size());
+    }
+    for (std::size_t dim = 0; dim < other.vertices_.size(); ++dim) {
+      vertices_[dim].insert(vertices_[dim].end(), other.vertices_[dim].begin(), other.vertices_[dim].end());
+      filtrations_[dim].insert(filtrations_[dim].end(), other.filtrations_[dim].begin(),
+                               other.filtrations_[dim].end());
+    }
+    other.vertices_.clear();
+    other.filtrations_.clear();
+  }
+
+  /* \brief Calls insert(simplex, filtration) on each distinct simplex, with its minimal filtration value, by
+   * increasing dimension and in lexicographical order, which gives a good locality to the insertions in a
+   * `Simplex_tree`. */
+  template<typename Insert>
+  void for_each_distinct_simplex(Insert&& insert) const {
+    for (std::size_t dim = 0; dim < vertices_.size(); ++dim)
+      for_each_distinct_simplex_of_dimension(dim, insert, std::integral_constant<std::size_t, 1>());
+  }
+
+ private:
+  // Simplices of a given dimension are sorted as records of fixed size, which is much faster than sorting their
+  // indices, up to this number of vertices.
+  static const std::size_t max_record_size = 8;
+
+  template<typename Insert, std::size_t Size>
+  void for_each_distinct_simplex_of_dimension(std::size_t dim, Insert& insert,
+                                              std::integral_constant<std::size_t, Size>) const {
+    if (dim + 1 != Size) {
+      for_each_distinct_simplex_of_dimension(dim, insert, std::integral_constant<std::size_t, Size + 1>());
+      return;
+    }
+    typedef std::pair<std::array<Vertex_handle, Size>, double> Record;
+    std::vector<Record> records(filtrations_[dim].size());
+    for (std::size_t i = 0; i < records.size(); ++i) {
+      std::copy_n(vertices_[dim].begin() + i * Size, Size, records[i].first.begin());
+      records[i].second = filtrations_[dim][i];
+    }
+    // Sorted by vertices, then by filtration value: the first copy of a simplex has its minimal filtration value.
+    std::sort(records.begin(), records.end());
+    std::vector<Vertex_handle> simplex;
+    for (std::size_t k = 0; k < records.size(); ++k) {
+      if (k > 0 && records[k].first == records[k - 1].first) continue;
+      simplex.assign(records[k].first.begin(), records[k].first.end());
+      insert(simplex, records[k].second);
+    }
+  }
+
+  template<typename Insert>
+  void for_each_distinct_simplex_of_dimension(std::size_t dim, Insert& insert,
+                                              std::integral_constant<std::size_t, max_record_size + 1>) const {
+    const std::size_t stride = dim + 1;
+    const std::vector<Vertex_handle>& vertices = vertices_[dim];
+    const std::vector<double>& filtrations = filtrations_[dim];
+    auto face = [&vertices, stride](std::size_t i) { return vertices.begin() + i * stride; };
+    std::vector<std::size_t> order(filtrations.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+      if (std::equal(face(a), face(a) + stride, face(b))) return filtrations[a] < filtrations[b];
+      return std::lexicographical_compare(face(a), face(a) + stride, face(b), face(b) + stride);
+    });
+    std::vector<Vertex_handle> simplex;
+    for (std::size_t k = 0; k < order.size(); ++k) {
+      // The first copy of a simplex has its minimal filtration value.
+      if (k > 0 && std::equal(face(order[k]), face(order[k]) + stride, face(order[k - 1]))) continue;
+      simplex.assign(face(order[k]), face(order[k]) + stride);
+      insert(simplex, filtrations[order[k]]);
+    }
+  }
+
+  // For each dimension, the sorted vertices of the simplices one after the other, and their filtration values.
+  std::vector<std::vector<Vertex_handle>> vertices_;
+  std::vector<std::vector<double>> filtrations_;
+};
+
+}  // namespace witness_complex
+
+}  // namespace Gudhi
+
+#endif  // WITNESS_COMPLEX_SIMPLEX_BUFFER_H_
@@ -11,6 +11,7 @@
 #include <gudhi/Euclidean_witness_complex.h>
 #include <gudhi/Strong_witness_complex.h>
 #include <gudhi/Euclidean_strong_witness_complex.h>
+#include <gudhi/Witness_complex/Compact_nearest_landmark_table.h>
 
 #include <gudhi/Kd_tree_search.h>
 
@@ -103,6 +104,18 @@ BOOST_AUTO_TEST_CASE(simple_witness_complex) {
   std::clog << "relaxed_complex.num_simplices() = " << relaxed_complex_ne.num_simplices() << std::endl;
   BOOST_CHECK(relaxed_complex_ne.num_simplices() == 239);
 
+  // Weak witness complex: Euclidean version from the nearest landmarks it needs
+  Gudhi::witness_complex::Compact_nearest_landmark_table compact_nearest_landmark_table =
+      Gudhi::witness_complex::compute_nearest_landmark_table<Kernel>(landmarks, witnesses, 8.01, 2);
+  Gudhi::witness_complex::Witness_complex<Gudhi::witness_complex::Compact_nearest_landmark_table>
+      compact_witness_complex(compact_nearest_landmark_table);
+  Simplex_tree relaxed_complex2, compact_relaxed_complex2;
+  eucl_witness_complex.create_complex(relaxed_complex2, 8.01, 2);
+  compact_witness_complex.create_complex(compact_relaxed_complex2, 8.01, 2);
+
+  std::clog << "compact_relaxed_complex2.num_simplices() = " << compact_relaxed_complex2.num_simplices() << std::endl;
+  BOOST_CHECK(relaxed_complex2 == compact_relaxed_complex2);
+
 
   // Strong complex : Euclidean version
   EuclideanStrongWitnessComplex eucl_strong_witness_complex(landmarks,
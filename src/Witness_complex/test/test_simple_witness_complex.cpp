@@ -6,10 +6,15 @@
 #include <gudhi/Simplex_tree.h>
 
 #include <gudhi/Witness_complex.h>
+#include <gudhi/Strong_witness_complex.h>
+#include <gudhi/Witness_complex/Compact_nearest_landmark_table.h>
 
 #include <iostream>
 #include <vector>
 #include <utility>
+#include <random>
+#include <algorithm>  // for std::shuffle, std::sort
+#include <numeric>  // for std::iota
 
 
 BOOST_AUTO_TEST_CASE(simple_witness_complex) {
@@ -51,3 +56,95 @@ BOOST_AUTO_TEST_CASE(simple_witness_complex) {
   BOOST_CHECK(stree2.num_simplices() == 25);
 
 }
+
+BOOST_AUTO_TEST_CASE(parallel_witness_complex) {
+  using Nearest_landmark_range = std::vector<std::pair<std::size_t, double>>;
+  using Nearest_landmark_table = std::vector<Nearest_landmark_range>;
+  using Witness_complex = Gudhi::witness_complex::Witness_complex<Nearest_landmark_table>;
+  using Strong_witness_complex = Gudhi::witness_complex::Strong_witness_complex<Nearest_landmark_table>;
+  using Simplex_tree = Gudhi::Simplex_tree<>;
+
+  // 500 witnesses of 30 landmarks, at random increasing distances
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<double> distance(0., 1.);
+  Nearest_landmark_table nlt;
+  std::vector<std::size_t> landmarks(30);
+  std::iota(landmarks.begin(), landmarks.end(), 0);
+  for (int w = 0; w < 500; ++w) {
+    std::shuffle(landmarks.begin(), landmarks.end(), gen);
+    std::vector<double> distances(landmarks.size());
+    for (auto& d : distances) d = distance(gen);
+    std::sort(distances.begin(), distances.end());
+    Nearest_landmark_range range;
+    for (std::size_t i = 0; i < landmarks.size(); ++i) range.emplace_back(landmarks[i], distances[i]);
+    nlt.push_back(range);
+  }
+
+  Witness_complex witness_complex(nlt);
+  Simplex_tree stree, parallel_stree;
+  BOOST_CHECK(witness_complex.create_complex(stree, 0.1, 3));
+  BOOST_CHECK(witness_complex.parallel_create_complex(parallel_stree, 0.1, 3));
+  std::clog << "Number of simplices: " << stree.num_simplices() << std::endl;
+  // Same simplices with exactly the same filtration values.
+  BOOST_CHECK(stree == parallel_stree);
+  BOOST_CHECK(!witness_complex.parallel_create_complex(parallel_stree, 0.1, 3));
+
+  Strong_witness_complex strong_witness_complex(nlt);
+  Simplex_tree strong_stree, parallel_strong_stree;
+  BOOST_CHECK(strong_witness_complex.create_complex(strong_stree, 0.1, 3));
+  BOOST_CHECK(strong_witness_complex.parallel_create_complex(parallel_strong_stree, 0.1, 3));
+  std::clog << "Number of simplices: " << strong_stree.num_simplices() << std::endl;
+  BOOST_CHECK(strong_stree == parallel_strong_stree);
+}
+
+BOOST_AUTO_TEST_CASE(compact_nearest_landmark_table) {
+  using Nearest_landmark_range = std::vector<std::pair<std::size_t, double>>;
+  using Nearest_landmark_table = std::vector<Nearest_landmark_range>;
+  using Compact_nearest_landmark_table = Gudhi::witness_complex::Compact_nearest_landmark_table;
+  using Simplex_tree = Gudhi::Simplex_tree<>;
+
+  // 1500 witnesses, i.e. more than a batch, of 30 landmarks, at random increasing distances
+  std::mt19937 gen(2);
+  std::uniform_real_distribution<double> distance(0., 1.);
+  Nearest_landmark_table nlt;
+  std::vector<std::size_t> landmarks(30);
+  std::iota(landmarks.begin(), landmarks.end(), 0);
+  for (int w = 0; w < 1500; ++w) {
+    std::shuffle(landmarks.begin(), landmarks.end(), gen);
+    std::vector<double> distances(landmarks.size());
+    for (auto& d : distances) d = distance(gen);
+    std::sort(distances.begin(), distances.end());
+    Nearest_landmark_range range;
+    for (std::size_t i = 0; i < landmarks.size(); ++i) range.emplace_back(landmarks[i], distances[i]);
+    nlt.push_back(range);
+  }
+  Gudhi::witness_complex::Witness_complex<Nearest_landmark_table> witness_complex(nlt);
+
+  // Each witness is its own range of nearest landmarks.
+  Compact_nearest_landmark_table compact_nlt(nlt, [](const Nearest_landmark_range& w) -> const Nearest_landmark_range& {
+    return w;
+  }, 0.1, 3);
+  BOOST_CHECK(compact_nlt.size() == nlt.size());
+  std::size_t num_landmarks = 0;
+  for (std::size_t w = 0; w < compact_nlt.size(); ++w) {
+    BOOST_CHECK(compact_nlt[w].size() >= 4);
+    BOOST_CHECK(std::equal(compact_nlt[w].begin(), compact_nlt[w].end(), nlt[w].begin()));
+    num_landmarks += compact_nlt[w].size();
+  }
+  std::clog << "Number of nearest landmarks: " << num_landmarks << " instead of " << 1500 * 30 << std::endl;
+  BOOST_CHECK(num_landmarks < 1500 * 30);
+
+  Gudhi::witness_complex::Witness_complex<Compact_nearest_landmark_table> compact_witness_complex(compact_nlt);
+  // Same complexes for smaller relaxations and dimensions as well.
+  for (double max_alpha_square : {0., 0.05, 0.1}) {
+    for (std::size_t limit_dimension : {1, 2, 3}) {
+      Simplex_tree stree, compact_stree, parallel_compact_stree;
+      BOOST_CHECK(witness_complex.create_complex(stree, max_alpha_square, limit_dimension));
+      BOOST_CHECK(compact_witness_complex.create_complex(compact_stree, max_alpha_square, limit_dimension));
+      BOOST_CHECK(compact_witness_complex.parallel_create_complex(parallel_compact_stree, max_alpha_square,
+                                                                  limit_dimension));
+      BOOST_CHECK(stree == compact_stree);
+      BOOST_CHECK(stree == parallel_compact_stree);
+    }
+  }
+}
@@ -31,6 +31,12 @@ if (DEBUG_TRACES)
   add_definitions(-DDEBUG_TRACES)
 endif()
 
+option(WITH_GUDHI_INSTRUMENTATION "Build with the timers and counters of gudhi/Instrumentation.h" OFF)
+if (WITH_GUDHI_INSTRUMENTATION)
+  message(STATUS "Instrumentation is activated")
+  add_definitions(-DGUDHI_USE_INSTRUMENTATION)
+endif()
+
 if(CMAKE_BUILD_TYPE MATCHES Debug)
   message("++ Debug compilation flags are: ${CMAKE_CXX_FLAGS} ${CMAKE_CXX_FLAGS_DEBUG}")
 else()
@@ -0,0 +1,444 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Clément Maria
+ *
+ *    Copyright (C) 2020 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#include <gudhi/Simplex_tree.h>
+#include <gudhi/Rips_complex.h>
+#include <gudhi/distance_functions.h>
+#include <gudhi/Persistent_cohomology.h>
+#include <gudhi/Zero_dimensional_persistence.h>
+#include <gudhi/Flag_complex_edge_collapser.h>
+#include <gudhi/Bitmap_cubical_complex.h>
+#include <gudhi/Witness_complex.h>
+#include <gudhi/Sliced_Wasserstein.h>
+
+#ifdef GUDHI_BENCHMARK_WITH_CGAL
+#include <gudhi/Alpha_complex.h>
+#include <gudhi/Bottleneck.h>
+#include <CGAL/Epick_d.h>
+#endif
+
+#include <boost/program_options.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/json_parser.hpp>
+
+#ifdef __linux__
+#include <sys/resource.h>
+#endif
+#ifdef __GLIBC__
+#include <malloc.h>  // for malloc_trim
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+/* Runs a fixed set of workloads on reproducible synthetic data, and reports, for each of them, its time, the peak
+ * memory during its execution and the size of its result in JSON, or compares two such reports.
+ * Usage:
+ *   Benchmark_suite [--output report.json] [--repetitions 3] [--filter rips]
+ *   Benchmark_suite --compare baseline.json report.json [--tolerance 0.1]
+ */
+
+using Simplex_tree = Gudhi::Simplex_tree<Gudhi::Simplex_tree_options_fast_persistence>;
+using Filtration_value = Simplex_tree::Filtration_value;
+using Field_Zp = Gudhi::persistent_cohomology::Field_Zp;
+using Point = std::vector<double>;
+using Diagram = std::vector<std::pair<double, double>>;
+
+// Generators that only use the output of std::mt19937, whose sequence is specified by the standard, so that the
+// data sets are the same with every compiler and standard library.
+class Point_generator {
+ public:
+  explicit Point_generator(std::uint32_t seed) : gen_(seed) {}
+
+  double uniform() { return gen_() / 4294967296.; }
+
+  // Points on a torus of radii 1 and 0.5 in R^3.
+  std::vector<Point> torus(std::size_t n) {
+    std::vector<Point> points;
+    for (std::size_t i = 0; i < n; ++i) {
+      double u = 2 * pi * uniform(), v = 2 * pi * uniform();
+      points.push_back({(1 + 0.5 * std::cos(v)) * std::cos(u), (1 + 0.5 * std::cos(v)) * std::sin(u),
+                        0.5 * std::sin(v)});
+    }
+    return points;
+  }
+
+  // Points uniformly distributed in the unit cube of dimension d.
+  std::vector<Point> cube(std::size_t n, std::size_t d) {
+    std::vector<Point> points(n, Point(d));
+    for (Point& p : points)
+      for (double& x : p) x = uniform();
+    return points;
+  }
+
+  // Diagram with n points above the diagonal in [0, 1]^2.
+  Diagram diagram(std::size_t n) {
+    Diagram diagram;
+    for (std::size_t i = 0; i < n; ++i) {
+      double birth = uniform();
+      diagram.emplace_back(birth, birth + (1 - birth) * uniform());
+    }
+    return diagram;
+  }
+
+ private:
+  static constexpr double pi = 3.14159265358979323846;
+  std::mt19937 gen_;
+};
+
+// Peak resident memory of the process in kB. On Linux, the peak is reset before each workload, so that it is the
+// peak of the workload, otherwise it is the peak since the start of the process.
+class Peak_memory {
+ public:
+  static void reset() {
+#ifdef __GLIBC__
+    // Gives back the memory freed by the previous workloads, which would otherwise count as resident.
+    malloc_trim(0);
+#endif
+#ifdef __linux__
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    if (clear_refs) clear_refs << "5";
+#endif
+  }
+
+  static long kilobytes() {
+#ifdef __linux__
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+      if (line.compare(0, 6, "VmHWM:") == 0) return std::atol(line.c_str() + 6);
+    }
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) return usage.ru_maxrss;
+#endif
+    return -1;
+  }
+};
+
+// A workload returns its metrics, e.g. the number of simplices of the complex it builds.
+using Metrics = std::vector<std::pair<std::string, double>>;
+
+struct Workload {
+  std::string name;
+  std::string parameters;
+  std::function<Metrics()> run;
+};
+
+template <typename Complex, typename Reduction = Gudhi::persistent_cohomology::Annotation_matrix_reduction>
+std::size_t num_intervals(Complex& complex, int dim_max) {
+  Gudhi::persistent_cohomology::Persistent_cohomology<Complex, Field_Zp, Reduction> pcoh(complex);
+  pcoh.init_coefficients(2);
+  pcoh.compute_persistent_cohomology();
+  std::size_t num = 0;
+  for (int dim = 0; dim < dim_max; ++dim) num += pcoh.intervals_in_dimension(dim).size();
+  return num;
+}
+
+std::vector<Workload> workloads() {
+  std::vector<Workload> w;
+
+  // Inputs are generated outside of the timed functions.
+  const std::size_t rips_n = 2000;
+  const Filtration_value rips_threshold = 0.3;
+  const int rips_dim = 3;
+  auto rips_points = std::make_shared<std::vector<Point>>(Point_generator(1).torus(rips_n));
+  auto rips_complex = [=]() {
+    Simplex_tree st;
+    Gudhi::rips_complex::Rips_complex<Filtration_value> rips(*rips_points, rips_threshold, Gudhi::Euclidean_distance());
+    rips.create_complex(st, rips_dim);
+    return st;
+  };
+  std::string rips_parameters = "torus, n=" + std::to_string(rips_n) + ", threshold=0.3, dim_max=3";
+
+  w.push_back({"rips_construction", rips_parameters, [=]() -> Metrics {
+    Simplex_tree st = rips_complex();
+    return {{"num_simplices", st.num_simplices()}};
+  }});
+  w.push_back({"rips_persistence", rips_parameters, [=]() -> Metrics {
+    Simplex_tree st = rips_complex();
+    return {{"num_simplices", st.num_simplices()}, {"num_intervals", num_intervals(st, rips_dim)}};
+  }});
+  w.push_back({"zero_dimensional_persistence", rips_parameters, [=]() -> Metrics {
+    Gudhi::persistent_cohomology::Zero_dimensional_persistence<Filtration_value> zero_pers(
+        *rips_points, rips_threshold, Gudhi::Euclidean_distance());
+    zero_pers.compute_persistence();
+    return {{"num_edges", zero_pers.num_edges()}, {"num_intervals", zero_pers.intervals().size()}};
+  }});
+
+  w.push_back({"edge_collapse", rips_parameters, [=]() -> Metrics {
+    using Filtered_edge = std::tuple<int, int, Filtration_value>;
+    std::vector<Filtered_edge> edges;
+    const std::vector<Point>& points = *rips_points;
+    for (std::size_t i = 0; i < points.size(); ++i)
+      for (std::size_t j = 0; j < i; ++j) {
+        Filtration_value d = Gudhi::Euclidean_distance()(points[i], points[j]);
+        if (d <= rips_threshold) edges.emplace_back(i, j, d);
+      }
+    std::size_t num_edges = edges.size();
+    auto remaining_edges = Gudhi::collapse::flag_complex_collapse_edges(edges);
+    Simplex_tree st;
+    for (std::size_t i = 0; i < points.size(); ++i) st.insert_simplex({static_cast<int>(i)}, 0.);
+    for (auto& e : remaining_edges) st.insert_simplex({std::get<0>(e), std::get<1>(e)}, std::get<2>(e));
+    st.expansion(rips_dim);
+    return {{"num_edges", num_edges}, {"num_remaining_edges", remaining_edges.size()},
+            {"num_simplices", st.num_simplices()}, {"num_intervals", num_intervals(st, rips_dim)}};
+  }});
+
+  const unsigned cubical_size = 48;
+  auto cubical_data = std::make_shared<std::vector<double>>();
+  {
+    Point_generator gen(2);
+    for (unsigned i = 0; i < cubical_size * cubical_size * cubical_size; ++i) cubical_data->push_back(gen.uniform());
+  }
+  using Bitmap_cubical_complex = Gudhi::cubical_complex::Bitmap_cubical_complex<
+      Gudhi::cubical_complex::Bitmap_cubical_complex_base<double>>;
+  w.push_back({"cubical_persistence", "random 3D bitmap, 48^3 top dimensional cells", [=]() -> Metrics {
+    Bitmap_cubical_complex b(std::vector<unsigned>(3, cubical_size), *cubical_data);
+    return {{"num_cells", b.num_simplices()}, {"num_intervals", num_intervals(b, 3)}};
+  }});
+  w.push_back({"cubical_persistence_in_chunks", "random 3D bitmap, 48^3 top dimensional cells", [=]() -> Metrics {
+    Bitmap_cubical_complex b(std::vector<unsigned>(3, cubical_size), *cubical_data);
+    return {{"num_cells", b.num_simplices()},
+            {"num_intervals", num_intervals<Bitmap_cubical_complex, Gudhi::persistent_cohomology::Chunk_reduction>(
+                                  b, 3)}};
+  }});
+
+  const std::size_t num_witnesses = 5000, num_landmarks = 200;
+  using Nearest_landmark_table = std::vector<std::vector<std::pair<std::size_t, double>>>;
+  auto witness_table = std::make_shared<Nearest_landmark_table>();
+  {
+    Point_generator gen(3);
+    std::vector<Point> witnesses = gen.torus(num_witnesses);
+    for (const Point& witness : witnesses) {
+      witness_table->emplace_back();
+      for (std::size_t l = 0; l < num_landmarks; ++l)
+        witness_table->back().emplace_back(l, Gudhi::Euclidean_distance()(witness, witnesses[l * 25]));
+      std::sort(witness_table->back().begin(), witness_table->back().end(),
+                [](const std::pair<std::size_t, double>& a, const std::pair<std::size_t, double>& b) {
+                  return a.second < b.second;
+                });
+    }
+  }
+  w.push_back({"witness_construction", "torus, 5000 witnesses, 200 landmarks, alpha=0.1, dim_max=3",
+               [=]() -> Metrics {
+    Simplex_tree st;
+    Gudhi::witness_complex::Witness_complex<Nearest_landmark_table> witness_complex(*witness_table);
+    witness_complex.create_complex(st, 0.1, 3);
+    return {{"num_simplices", st.num_simplices()}};
+  }});
+
+  auto diagrams = std::make_shared<std::pair<Diagram, Diagram>>();
+  {
+    Point_generator gen(4);
+    diagrams->first = gen.diagram(1000);
+    diagrams->second = gen.diagram(1000);
+  }
+  w.push_back({"sliced_wasserstein", "2 random diagrams of 1000 points, 100 directions", [=]() -> Metrics {
+    Gudhi::Persistence_representations::Sliced_Wasserstein sw1(diagrams->first, 1., 100);
+    Gudhi::Persistence_representations::Sliced_Wasserstein sw2(diagrams->second, 1., 100);
+    return {{"distance", sw1.distance(sw2)}};
+  }});
+
+#ifdef GUDHI_BENCHMARK_WITH_CGAL
+  using Kernel = CGAL::Epick_d<CGAL::Dimension_tag<3>>;
+  const std::size_t alpha_n = 20000;
+  auto alpha_points = std::make_shared<std::vector<Kernel::Point_d>>();
+  for (const Point& p : Point_generator(5).torus(alpha_n)) alpha_points->emplace_back(p.begin(), p.end());
+  w.push_back({"alpha_construction", "torus, n=20000", [=]() -> Metrics {
+    Gudhi::alpha_complex::Alpha_complex<Kernel> alpha(*alpha_points);
+    Simplex_tree st;
+    alpha.create_complex(st);
+    return {{"num_simplices", st.num_simplices()}};
+  }});
+  w.push_back({"alpha_persistence", "torus, n=20000", [=]() -> Metrics {
+    Gudhi::alpha_complex::Alpha_complex<Kernel> alpha(*alpha_points);
+    Simplex_tree st;
+    alpha.create_complex(st);
+    return {{"num_simplices", st.num_simplices()}, {"num_intervals", num_intervals(st, 3)}};
+  }});
+
+  w.push_back({"bottleneck", "2 random diagrams of 1000 points, exact", [=]() -> Metrics {
+    return {{"distance", Gudhi::persistence_diagram::bottleneck_distance(diagrams->first, diagrams->second)}};
+  }});
+#endif
+
+  return w;
+}
+
+std::string json_string(const std::string& s) {
+  std::string escaped = "\"";
+  for (char c : s) {
+    if (c == '"' || c == '\\') escaped += '\\';
+    escaped += c;
+  }
+  return escaped + "\"";
+}
+
+int run(const std::string& output, int repetitions, const std::string& filter) {
+  std::ostringstream json;
+  json << std::setprecision(10);
+  json << "{\n  \"configuration\": {\n"
+#ifdef __VERSION__
+       << "    \"compiler\": " << json_string(__VERSION__) << ",\n"
+#endif
+#ifdef GUDHI_USE_TBB
+       << "    \"tbb\": true,\n"
+#else
+       << "    \"tbb\": false,\n"
+#endif
+#ifdef GUDHI_BENCHMARK_WITH_CGAL
+       << "    \"cgal\": true,\n"
+#else
+       << "    \"cgal\": false,\n"
+#endif
+       << "    \"repetitions\": " << repetitions << "\n  },\n  \"workloads\": [";
+  bool first = true;
+  for (const Workload& workload : workloads()) {
+    if (workload.name.find(filter) == std::string::npos) continue;
+    double seconds = std::numeric_limits<double>::infinity();
+    long peak_memory = -1;
+    Metrics metrics;
+    for (int i = 0; i < repetitions; ++i) {
+      Peak_memory::reset();
+      auto start = std::chrono::steady_clock::now();
+      metrics = workload.run();
+      std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+      seconds = (std::min)(seconds, elapsed.count());
+      peak_memory = (std::max)(peak_memory, Peak_memory::kilobytes());
+    }
+    std::clog << std::left << std::setw(24) << workload.name << seconds << "s, " << peak_memory << " kB\n";
+    json << (first ? "" : ",") << "\n    {\n      \"name\": " << json_string(workload.name)
+         << ",\n      \"parameters\": " << json_string(workload.parameters) << ",\n      \"seconds\": " << seconds
+         << ",\n      \"peak_memory_kb\": " << peak_memory << ",\n      \"metrics\": {";
+    for (std::size_t i = 0; i < metrics.size(); ++i)
+      json << (i ? ", " : "") << json_string(metrics[i].first) << ": " << metrics[i].second;
+    json << "}\n    }";
+    first = false;
+  }
+  json << "\n  ]\n}\n";
+
+  if (output.empty()) {
+    std::cout << json.str();
+  } else {
+    std::ofstream out(output);
+    out << json.str();
+    if (!out) {
+      std::cerr << "Cannot write " << output << "\n";
+      return 2;
+    }
+  }
+  return 0;
+}
+
+// Times and results by workload name.
+using Report = std::map<std::string, boost::property_tree::ptree>;
+
+Report read_report(const std::string& file_name) {
+  boost::property_tree::ptree tree;
+  boost::property_tree::read_json(file_name, tree);
+  Report report;
+  for (auto& workload : tree.get_child("workloads")) report[workload.second.get<std::string>("name")] = workload.second;
+  return report;
+}
+
+/* Prints the ratio of the times and of the peak memory of the workloads of both reports, and the metrics that
+ * changed. Returns 1 if a workload is slower or uses more memory by more than the tolerance, 0 otherwise. */
+int compare(const std::string& baseline_file, const std::string& current_file, double tolerance) {
+  Report baseline = read_report(baseline_file), current = read_report(current_file);
+  // Below this time, the differences are mostly noise.
+  const double min_seconds = 0.01;
+  int status = 0;
+  std::cout << std::left << std::setw(24) << "workload" << std::setw(12) << "time" << std::setw(12) << "memory"
+            << "\n";
+  for (auto& entry : current) {
+    auto it = baseline.find(entry.first);
+    if (it == baseline.end()) {
+      std::cout << std::setw(24) << entry.first << "not in the baseline\n";
+      continue;
+    }
+    const boost::property_tree::ptree &before = it->second, &after = entry.second;
+    double seconds_before = before.get<double>("seconds"), seconds_after = after.get<double>("seconds");
+    double memory_before = before.get<double>("peak_memory_kb"), memory_after = after.get<double>("peak_memory_kb");
+    double time_ratio = seconds_after / seconds_before, memory_ratio = memory_after / memory_before;
+    bool slower = time_ratio > 1 + tolerance && seconds_after > min_seconds;
+    bool bigger = memory_ratio > 1 + tolerance && memory_before > 0;
+    std::ostringstream time, memory;
+    time << std::fixed << std::setprecision(2) << time_ratio << "x" << (slower ? "!" : "");
+    memory << std::fixed << std::setprecision(2) << memory_ratio << "x" << (bigger ? "!" : "");
+    std::cout << std::setw(24) << entry.first << std::setw(12) << time.str() << std::setw(12) << memory.str();
+    if (before.get<std::string>("parameters") != after.get<std::string>("parameters"))
+      std::cout << " different parameters";
+    for (auto& metric : after.get_child("metrics")) {
+      auto old_value = before.get_optional<std::string>("metrics." + metric.first);
+      if (!old_value || *old_value != metric.second.data())
+        std::cout << " " << metric.first << ": " << (old_value ? *old_value : "?") << " -> " << metric.second.data();
+    }
+    std::cout << "\n";
+    if (slower || bigger) status = 1;
+  }
+  if (status) std::cout << "Regression of more than " << 100 * tolerance << "% (marked with !)\n";
+  return status;
+}
+
+int main(int argc, char* argv[]) {
+  namespace po = boost::program_options;
+  std::string output, filter;
+  int repetitions;
+  double tolerance;
+  std::vector<std::string> compared;
+
+  po::options_description visible("Options");
+  visible.add_options()
+      ("help,h", "Produce help message")
+      ("output,o", po::value<std::string>(&output), "JSON report file. The report is written on stdout by default.")
+      ("repetitions,r", po::value<int>(&repetitions)->default_value(3),
+       "Number of runs of each workload, the minimal time is reported.")
+      ("filter,f", po::value<std::string>(&filter)->default_value(""),
+       "Only run the workloads whose name contains this string.")
+      ("compare,c", po::value<std::vector<std::string>>(&compared)->multitoken(),
+       "Compare two JSON reports, baseline first, instead of running the workloads.")
+      ("tolerance,t", po::value<double>(&tolerance)->default_value(0.1),
+       "Relative increase of time or memory reported as a regression by --compare.");
+
+  po::variables_map vm;
+  try {
+    po::store(po::parse_command_line(argc, argv, visible), vm);
+    po::notify(vm);
+  } catch (const po::error& e) {
+    std::cerr << e.what() << "\n" << visible;
+    return 2;
+  }
+  if (vm.count("help")) {
+    std::cout << "Usage: " << argv[0] << " [options]\n"
+              << "Runs GUDHI workloads on synthetic data and reports their time and memory in JSON.\n" << visible;
+    return 0;
+  }
+  if (vm.count("compare")) {
+    if (compared.size() != 2) {
+      std::cerr << "--compare requires two reports\n";
+      return 2;
+    }
+    return compare(compared[0], compared[1], tolerance);
+  }
+  return run(output, (std::max)(repetitions, 1), filter);
+}
@@ -37,6 +37,24 @@ make \endverbatim
  * program). If some of the tests are failing, please send us the result of the following command:
  * \verbatim ctest --output-on-failure \endverbatim
  * 
+ * \subsection instrumentation Instrumentation
+ * With `cmake -DWITH_GUDHI_INSTRUMENTATION=ON ..`, `GUDHI_USE_INSTRUMENTATION` is defined and the main steps of the
+ * constructions and of the persistence computation (`Simplex_tree::expansion`,
+ * `Simplex_tree::initialize_filtration`, `Persistent_cohomology::compute_persistent_cohomology`,
+ * `Flag_complex_edge_collapser::process_edges`, the `create_complex` methods of the Rips and Alpha complexes...)
+ * record their time, nested by caller, and a few counters such as the number of column additions of the reduction.
+ * They are retrieved with `Gudhi::instrumentation::report()`, defined in `gudhi/Instrumentation.h`, or
+ * `gudhi.instrumentation.report()` in Python. Without this option, the timers and counters are compiled out.
+ *
+ * \subsection benchmarksuite Benchmark suite
+ * With `cmake -DWITH_GUDHI_BENCHMARK=ON ..`, `make Benchmark_suite` builds a driver that runs Rips, edge collapse,
+ * cubical, witness and Sliced Wasserstein workloads (and Alpha and bottleneck ones when CGAL is available) on seeded
+ * synthetic data, and writes their time, peak memory and result sizes in JSON:
+ * \verbatim src/common/benchmark/Benchmark_suite --output new.json \endverbatim
+ * Two reports are compared with
+ * \verbatim src/common/benchmark/Benchmark_suite --compare old.json new.json --tolerance 0.1 \endverbatim
+ * which exits with a non-zero status when a workload is more than 10% slower or bigger.
+ *
  * \subsection documentationgeneration Documentation
  * To generate the documentation, <a target="_blank" href="http://www.doxygen.org/">Doxygen</a> is required.
  * Run the following command in a terminal:
@@ -0,0 +1,181 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Clément Maria
+ *
+ *    Copyright (C) 2020 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef INSTRUMENTATION_H_
+#define INSTRUMENTATION_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>  // for std::uintmax_t
+#include <cstddef>  // for std::size_t
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <tuple>  // for std::piecewise_construct, std::forward_as_tuple
+#include <vector>
+
+/** \def GUDHI_INSTRUMENT_SCOPE(name)
+ * Adds the time spent until the end of the enclosing block to the timer `name`, nested in the timers of the blocks
+ * being measured by the same thread. Does nothing unless `GUDHI_USE_INSTRUMENTATION` is defined.
+ *
+ * \def GUDHI_INSTRUMENT_COUNT(name, n)
+ * Adds `n` to the counter `name`. Does nothing unless `GUDHI_USE_INSTRUMENTATION` is defined.
+ */
+#ifdef GUDHI_USE_INSTRUMENTATION
+# define GUDHI_INSTRUMENT_CONCAT_(a, b) a##b
+# define GUDHI_INSTRUMENT_CONCAT(a, b) GUDHI_INSTRUMENT_CONCAT_(a, b)
+# define GUDHI_INSTRUMENT_SCOPE(name) \
+  Gudhi::instrumentation::Scoped_timer GUDHI_INSTRUMENT_CONCAT(gudhi_instrument_scope_, __LINE__)(name)
+# define GUDHI_INSTRUMENT_COUNT(name, n) \
+  do { \
+    static std::atomic<std::uintmax_t>& gudhi_instrument_counter = \
+        Gudhi::instrumentation::Registry::instance().counter(name); \
+    gudhi_instrument_counter.fetch_add(n, std::memory_order_relaxed); \
+  } while (0)
+#else
+# define GUDHI_INSTRUMENT_SCOPE(name) (void) 0
+# define GUDHI_INSTRUMENT_COUNT(name, n) (void) 0
+#endif
+
+namespace Gudhi {
+
+namespace instrumentation {
+
+/** \brief Time measured by a timer. The name of a timer is the path of the names of the enclosing timers, separated
+ * by '/', e.g. "Rips_complex::create_complex/Simplex_tree::expansion". */
+struct Timer_record {
+  std::string name;
+  std::size_t calls;
+  double seconds;
+};
+
+/** \brief Timers, sorted by name so that a timer follows its parent, and counters. */
+struct Report {
+  std::vector<Timer_record> timers;
+  std::map<std::string, std::uintmax_t> counters;
+
+  /** \brief Writes one line per timer, indented by depth, then one line per counter. */
+  friend std::ostream& operator<<(std::ostream& os, const Report& report) {
+    for (const Timer_record& timer : report.timers) {
+      std::size_t last_separator = timer.name.rfind('/');
+      std::size_t depth = 0;
+      for (char c : timer.name) depth += (c == '/');
+      os << std::string(2 * depth, ' ')
+         << (last_separator == std::string::npos ? timer.name : timer.name.substr(last_separator + 1)) << ": "
+         << timer.seconds << "s (" << timer.calls << " calls)\n";
+    }
+    for (const auto& counter : report.counters) os << counter.first << ": " << counter.second << "\n";
+    return os;
+  }
+};
+
+/** \brief Global registry of the timers and counters, which is thread safe.
+ *
+ * It is filled by `GUDHI_INSTRUMENT_SCOPE` and `GUDHI_INSTRUMENT_COUNT`, only when `GUDHI_USE_INSTRUMENTATION` is
+ * defined, otherwise its report is always empty.
+ */
+class Registry {
+ public:
+  static Registry& instance() {
+    static Registry registry;
+    return registry;
+  }
+
+  void add_time(const std::string& name, double seconds) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Timer_data& timer = timers_[name];
+    ++timer.calls;
+    timer.seconds += seconds;
+  }
+
+  /** \brief Returns the counter `name`, which remains valid after `reset()`. */
+  std::atomic<std::uintmax_t>& counter(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = counters_.find(name);
+    if (it == counters_.end())
+      it = counters_.emplace(std::piecewise_construct, std::forward_as_tuple(name), std::forward_as_tuple(0)).first;
+    return it->second;
+  }
+
+  Report report() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Report report;
+    for (const auto& timer : timers_) report.timers.push_back({timer.first, timer.second.calls, timer.second.seconds});
+    for (const auto& counter : counters_) {
+      std::uintmax_t value = counter.second.load(std::memory_order_relaxed);
+      if (value != 0) report.counters.emplace(counter.first, value);
+    }
+    return report;
+  }
+
+  /** \brief Clears the timers and sets the counters to 0. */
+  void reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    timers_.clear();
+    for (auto& counter : counters_) counter.second.store(0, std::memory_order_relaxed);
+  }
+
+ private:
+  Registry() {}
+
+  struct Timer_data {
+    std::size_t calls = 0;
+    double seconds = 0;
+  };
+
+  mutable std::mutex mutex_;
+  std::map<std::string, Timer_data> timers_;
+  // The nodes of a map are never moved, the counters can be referenced by the callers.
+  std::map<std::string, std::atomic<std::uintmax_t>> counters_;
+};
+
+/** \brief Measures the time until its destruction, and adds it to the registry under the path of the timers alive in
+ * the same thread. */
+class Scoped_timer {
+ public:
+  explicit Scoped_timer(const char* name) : start_(std::chrono::steady_clock::now()) {
+    std::string& path = current_path();
+    previous_size_ = path.size();
+    if (!path.empty()) path += '/';
+    path += name;
+  }
+
+  ~Scoped_timer() {
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_;
+    std::string& path = current_path();
+    Registry::instance().add_time(path, elapsed.count());
+    path.resize(previous_size_);
+  }
+
+  Scoped_timer(const Scoped_timer&) = delete;
+  Scoped_timer& operator=(const Scoped_timer&) = delete;
+
+ private:
+  static std::string& current_path() {
+    static thread_local std::string path;
+    return path;
+  }
+
+  std::chrono::steady_clock::time_point start_;
+  std::size_t previous_size_;
+};
+
+/** \brief Returns the timers and counters recorded since the start of the program or the last `reset()`. */
+inline Report report() { return Registry::instance().report(); }
+
+/** \brief Clears the timers and counters. */
+inline void reset() { Registry::instance().reset(); }
+
+}  // namespace instrumentation
+
+}  // namespace Gudhi
+
+#endif  // INSTRUMENTATION_H_
@@ -11,11 +11,12 @@
 #ifndef GRAPH_SIMPLICIAL_COMPLEX_H_
 #define GRAPH_SIMPLICIAL_COMPLEX_H_
 
+#include <gudhi/proximity_edges.h>
+
 #include <boost/graph/adjacency_list.hpp>
 
 #include <utility>  // for pair<>
 #include <vector>
-#include <map>
 #include <tuple>  // for std::tie
 
 namespace Gudhi {
@@ -68,22 +69,8 @@ Proximity_graph<SimplicialComplexForProximityGraph> compute_proximity_graph(
 
   std::vector<std::pair< Vertex_handle, Vertex_handle >> edges;
   std::vector< Filtration_value > edges_fil;
-  std::map< Vertex_handle, Filtration_value > vertices;
-
-  Vertex_handle idx_u, idx_v;
-  Filtration_value fil;
-  idx_u = 0;
-  for (auto it_u = points.begin(); it_u != points.end(); ++it_u) {
-    idx_v = idx_u + 1;
-    for (auto it_v = it_u + 1; it_v != points.end(); ++it_v, ++idx_v) {
-      fil = distance(*it_u, *it_v);
-      if (fil <= threshold) {
-        edges.emplace_back(idx_u, idx_v);
-        edges_fil.push_back(fil);
-      }
-    }
-    ++idx_u;
-  }
+
+  Vertex_handle idx_u = compute_proximity_edges(points, threshold, distance, edges, edges_fil);
 
   // Points are labeled from 0 to idx_u-1
   Proximity_graph<SimplicialComplexForProximityGraph> skel_graph(edges.begin(), edges.end(), edges_fil.begin(), idx_u);
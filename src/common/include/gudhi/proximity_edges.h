@@ -0,0 +1,284 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Clément Maria
+ *
+ *    Copyright (C) 2020 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef PROXIMITY_EDGES_H_
+#define PROXIMITY_EDGES_H_
+
+#include <gudhi/Debug_utils.h>
+
+#ifdef GUDHI_USE_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#endif
+
+#include <vector>
+#include <utility>  // for std::pair, std::make_pair, std::declval
+#include <iterator>  // for std::begin, std::end
+#include <algorithm>  // for std::stable_sort, std::min, std::max
+#include <numeric>  // for std::iota
+#include <type_traits>  // for std::is_same, std::is_floating_point, std::decay
+#include <cstddef>  // for std::size_t
+
+namespace Gudhi {
+
+/** @file
+ * @brief Computation of the edges of a proximity graph
+ */
+
+class Euclidean_distance;
+
+namespace detail {
+
+/* Type of the coordinates of the points of ForwardPointRange when the points are ranges, void otherwise. */
+template<typename ForwardPointRange, typename = void>
+struct Point_coordinate {
+  typedef void type;
+};
+
+template<typename ForwardPointRange>
+struct Point_coordinate<ForwardPointRange,
+                        decltype(void(std::begin(*std::begin(std::declval<const ForwardPointRange&>()))))> {
+  typedef typename std::decay<decltype(*std::begin(*std::begin(std::declval<const ForwardPointRange&>())))>::type
+      type;
+};
+
+/* Whether the edges of the proximity graph of points and distance are computed by
+ * `compute_euclidean_proximity_edges`, i.e. distance is `Gudhi::Euclidean_distance` on points given by ranges of
+ * floating-point coordinates. */
+template<typename ForwardPointRange, typename Distance>
+using Has_euclidean_proximity_edges =
+    std::integral_constant<bool, std::is_same<Distance, Euclidean_distance>::value &&
+                                 std::is_floating_point<typename Point_coordinate<ForwardPointRange>::type>::value>;
+
+template<typename Vertex_handle, typename Filtration_value>
+struct Proximity_edge {
+  Vertex_handle u;
+  Vertex_handle v;
+  Filtration_value fil;
+};
+
+template<typename Vertex_handle, typename Filtration_value, typename ForwardPointRange, typename Distance>
+Vertex_handle compute_proximity_edges(const ForwardPointRange& points, Filtration_value threshold, Distance distance,
+                                      std::vector<std::pair<Vertex_handle, Vertex_handle>>& edges,
+                                      std::vector<Filtration_value>& edges_fil, std::false_type) {
+  Vertex_handle idx_u = 0;
+  for (auto it_u = std::begin(points); it_u != std::end(points); ++it_u, ++idx_u) {
+    Vertex_handle idx_v = idx_u + 1;
+    auto it_v = it_u;
+    for (++it_v; it_v != std::end(points); ++it_v, ++idx_v) {
+      Filtration_value fil = distance(*it_u, *it_v);
+      if (fil <= threshold) {
+        edges.emplace_back(idx_u, idx_v);
+        edges_fil.push_back(fil);
+      }
+    }
+  }
+  return idx_u;
+}
+
+/* Euclidean distance, filtered on a copy of the coordinates with the points sorted along the axis of largest extent,
+ * stored coordinate by coordinate.
+ * The difference of the coordinates along this axis is a lower bound on the distance, so only a window of the
+ * following points is compared to each point (unless the windows do not prune enough pairs to pay for sorting the
+ * edges). The squared distances from a point to its window are computed by tiles
+ * of consecutive points, in vectorized inner loops, and in parallel with TBB. They only select the candidate edges,
+ * with a margin for the rounding errors: the filtration value of a candidate is computed by `distance` on the input
+ * points, so that the edges and their filtration values are exactly the ones of the generic computation. */
+template<typename Vertex_handle, typename Filtration_value, typename ForwardPointRange, typename Distance>
+Vertex_handle compute_proximity_edges(const ForwardPointRange& points, Filtration_value threshold, Distance distance,
+                                      std::vector<std::pair<Vertex_handle, Vertex_handle>>& edges,
+                                      std::vector<Filtration_value>& edges_fil, std::true_type) {
+  typedef typename Point_coordinate<ForwardPointRange>::type NT;
+  typedef Proximity_edge<Vertex_handle, Filtration_value> Edge;
+
+  std::vector<decltype(std::begin(points))> point_iterators;
+  std::vector<NT> coordinates;
+  std::size_t dimension = 0;
+  std::size_t num_points = 0;
+  for (auto it = std::begin(points); it != std::end(points); ++it, ++num_points) {
+    point_iterators.push_back(it);
+    coordinates.insert(coordinates.end(), std::begin(*it), std::end(*it));
+    if (num_points == 0) dimension = coordinates.size();
+    GUDHI_CHECK(coordinates.size() == (num_points + 1) * dimension, "inconsistent point dimensions");
+  }
+  if (num_points < 2) return static_cast<Vertex_handle>(num_points);
+
+  std::size_t axis = 0;
+  NT largest_extent = 0;
+  for (std::size_t k = 0; k < dimension; ++k) {
+    NT min_coordinate = coordinates[k];
+    NT max_coordinate = coordinates[k];
+    for (std::size_t i = 1; i < num_points; ++i) {
+      min_coordinate = (std::min)(min_coordinate, coordinates[i * dimension + k]);
+      max_coordinate = (std::max)(max_coordinate, coordinates[i * dimension + k]);
+    }
+    if (max_coordinate - min_coordinate > largest_extent) {
+      largest_extent = max_coordinate - min_coordinate;
+      axis = k;
+    }
+  }
+
+  // order[i] is the index of the i-th point along the axis.
+  std::vector<Vertex_handle> order(num_points);
+  std::iota(order.begin(), order.end(), 0);
+  if (dimension > 0) {
+    std::stable_sort(order.begin(), order.end(), [&](Vertex_handle a, Vertex_handle b) {
+      return coordinates[a * dimension + axis] < coordinates[b * dimension + axis];
+    });
+  }
+
+  // Squared distances above bound cannot give a filtration value smaller than threshold, whatever the rounding errors.
+  NT bound = static_cast<NT>(threshold) * (1 + static_cast<NT>(1e-4));
+  bound = threshold < 0 ? -1 : bound * bound;
+
+  // The points i+1 to window_end[i]-1 are the candidates for an edge with the point i.
+  std::vector<std::size_t> window_end(num_points, num_points);
+  std::size_t num_candidates = 0;
+  if (dimension > 0) {
+    std::size_t end = 1;
+    for (std::size_t i = 0; i < num_points; ++i) {
+      end = (std::max)(end, i + 1);
+      while (end < num_points) {
+        NT tmp = coordinates[order[end] * dimension + axis] - coordinates[order[i] * dimension + axis];
+        if (!(tmp * tmp <= bound)) break;
+        ++end;
+      }
+      window_end[i] = end;
+      num_candidates += end - i - 1;
+    }
+  }
+  // When the windows contain most of the points, the points are compared in their input order instead, so that the
+  // edges are found in lexicographic order.
+  bool input_order = dimension == 0 || num_candidates > num_points * (num_points - 1) / 4;
+  if (input_order) {
+    std::iota(order.begin(), order.end(), 0);
+    window_end.assign(num_points, num_points);
+  }
+
+  // The coordinate k of the point order[i] is sorted[k * n + i].
+  std::vector<NT> sorted(num_points * dimension);
+  for (std::size_t k = 0; k < dimension; ++k)
+    for (std::size_t i = 0; i < num_points; ++i)
+      sorted[k * num_points + i] = coordinates[order[i] * dimension + k];
+  coordinates = std::vector<NT>();
+
+  const std::size_t tile_size = 64;
+  const std::size_t rows_per_block = 64;
+  std::size_t num_blocks = (num_points + rows_per_block - 1) / rows_per_block;
+  std::vector<std::vector<Edge>> block_edges(num_blocks);
+  auto compute_block = [&](std::size_t block) {
+    NT dist[tile_size];
+    std::vector<Edge>& output = block_edges[block];
+    std::size_t last_row = (std::min)(num_points, (block + 1) * rows_per_block);
+    for (std::size_t i = block * rows_per_block; i < last_row; ++i) {
+      for (std::size_t first = i + 1; first < window_end[i]; first += tile_size) {
+        std::size_t size = (std::min)(tile_size, window_end[i] - first);
+        for (std::size_t t = 0; t < size; ++t) dist[t] = 0;
+        for (std::size_t k = 0; k < dimension; ++k) {
+          const NT x = sorted[k * num_points + i];
+          const NT* tile = sorted.data() + k * num_points + first;
+          for (std::size_t t = 0; t < size; ++t) {
+            NT tmp = x - tile[t];
+            dist[t] += tmp * tmp;
+          }
+        }
+        for (std::size_t t = 0; t < size; ++t) {
+          if (!(dist[t] <= bound)) continue;
+          Vertex_handle u = (std::min)(order[i], order[first + t]);
+          Vertex_handle v = (std::max)(order[i], order[first + t]);
+          Filtration_value fil = distance(*point_iterators[u], *point_iterators[v]);
+          if (fil <= threshold) output.push_back(Edge{u, v, fil});
+        }
+      }
+    }
+  };
+#ifdef GUDHI_USE_TBB
+  tbb::parallel_for(tbb::blocked_range<std::size_t>(0, num_blocks), [&](const tbb::blocked_range<std::size_t>& r) {
+    for (std::size_t block = r.begin(); block != r.end(); ++block) compute_block(block);
+  });
+#else
+  for (std::size_t block = 0; block < num_blocks; ++block) compute_block(block);
+#endif
+  sorted = std::vector<NT>();
+
+  std::size_t first_edge = edges.size();
+  std::size_t num_edges = 0;
+  for (const auto& output : block_edges) num_edges += output.size();
+  edges.resize(first_edge + num_edges);
+  edges_fil.resize(first_edge + num_edges);
+  if (input_order) {
+    std::size_t e = first_edge;
+    for (auto& output : block_edges) {
+      for (const Edge& edge : output) {
+        edges[e] = std::make_pair(edge.u, edge.v);
+        edges_fil[e++] = edge.fil;
+      }
+      output = std::vector<Edge>();
+    }
+    return static_cast<Vertex_handle>(num_points);
+  }
+
+  // Same order as the generic computation: the edges are sorted by a counting sort on their largest vertex, then by a
+  // stable counting sort on their smallest vertex.
+  std::vector<std::size_t> position_u(num_points + 1, 0), position_v(num_points + 1, 0);
+  for (const auto& output : block_edges) {
+    for (const Edge& edge : output) {
+      ++position_u[edge.u + 1];
+      ++position_v[edge.v + 1];
+    }
+  }
+  for (std::size_t w = 0; w < num_points; ++w) {
+    position_u[w + 1] += position_u[w];
+    position_v[w + 1] += position_v[w];
+  }
+  std::vector<Edge> edges_by_v(num_edges);
+  for (auto& output : block_edges) {
+    for (const Edge& edge : output) edges_by_v[position_v[edge.v]++] = edge;
+    output = std::vector<Edge>();
+  }
+  for (const Edge& edge : edges_by_v) {
+    std::size_t e = first_edge + position_u[edge.u]++;
+    edges[e] = std::make_pair(edge.u, edge.v);
+    edges_fil[e] = edge.fil;
+  }
+  return static_cast<Vertex_handle>(num_points);
+}
+
+}  // namespace detail
+
+/** \brief Computes the edges of the proximity graph of the points.
+ *
+ * Appends to edges the pairs of indices [u,v], with u < v, such that the distance between the points u and v is
+ * smaller than threshold, in lexicographic order, and their distance to edges_fil.
+ *
+ * When distance is `Gudhi::Euclidean_distance` and the points are ranges of floating-point coordinates, the
+ * distances are computed by blocks of points, in parallel with TBB, and only for the pairs of points whose
+ * coordinates along the axis of largest extent differ by at most threshold. The edges and their filtration values
+ * are the same as with any other function computing the Euclidean distance with the same operations.
+ *
+ * @return The number of points.
+ *
+ * \tparam ForwardPointRange must be a range for which `std::begin` and `std::end` return forward iterators on a
+ * point.
+ *
+ * \tparam Distance furnishes `operator()(const Point& p1, const Point& p2)`, where
+ * `Point` is a point from the `ForwardPointRange`, and that returns a `Filtration_value`.
+ */
+template<typename Vertex_handle, typename Filtration_value, typename ForwardPointRange, typename Distance>
+Vertex_handle compute_proximity_edges(const ForwardPointRange& points, Filtration_value threshold, Distance distance,
+                                      std::vector<std::pair<Vertex_handle, Vertex_handle>>& edges,
+                                      std::vector<Filtration_value>& edges_fil) {
+  return detail::compute_proximity_edges(points, threshold, distance, edges, edges_fil,
+                                         detail::Has_euclidean_proximity_edges<ForwardPointRange, Distance>());
+}
+
+}  // namespace Gudhi
+
+#endif  // PROXIMITY_EDGES_H_
@@ -0,0 +1,65 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Clément Maria
+ *
+ *    Copyright (C) 2020 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+// Tests the timers and counters whatever the build options are
+#ifndef GUDHI_USE_INSTRUMENTATION
+#define GUDHI_USE_INSTRUMENTATION
+#endif
+#include <gudhi/Instrumentation.h>
+
+#include <iostream>
+#include <string>
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE "instrumentation"
+#include <boost/test/unit_test.hpp>
+
+void count_twice() {
+  for (int i = 0; i < 2; ++i) GUDHI_INSTRUMENT_COUNT("count", 1);
+}
+
+void inner() {
+  GUDHI_INSTRUMENT_SCOPE("inner");
+  count_twice();
+}
+
+void outer() {
+  GUDHI_INSTRUMENT_SCOPE("outer");
+  inner();
+  inner();
+}
+
+BOOST_AUTO_TEST_CASE( nested_timers_and_counters ) {
+  Gudhi::instrumentation::reset();
+  outer();
+  inner();
+  Gudhi::instrumentation::Report report = Gudhi::instrumentation::report();
+  std::clog << report;
+
+  BOOST_CHECK(report.timers.size() == 3);
+  // Sorted by name, a timer follows its parent
+  BOOST_CHECK(report.timers[0].name == "inner");
+  BOOST_CHECK(report.timers[0].calls == 1);
+  BOOST_CHECK(report.timers[1].name == "outer");
+  BOOST_CHECK(report.timers[1].calls == 1);
+  BOOST_CHECK(report.timers[2].name == "outer/inner");
+  BOOST_CHECK(report.timers[2].calls == 2);
+  BOOST_CHECK(report.timers[1].seconds >= report.timers[2].seconds);
+  BOOST_CHECK(report.counters.size() == 1);
+  BOOST_CHECK(report.counters["count"] == 6);
+
+  Gudhi::instrumentation::reset();
+  report = Gudhi::instrumentation::report();
+  BOOST_CHECK(report.timers.empty());
+  BOOST_CHECK(report.counters.empty());
+  // The counters are still registered after a reset
+  count_twice();
+  BOOST_CHECK(Gudhi::instrumentation::report().counters["count"] == 2);
+}
@@ -127,3 +127,15 @@ cdef class AlphaComplex:
             self.this_ptr.create_simplex_tree(<Simplex_tree_interface_full_featured*>stree_int_ptr,
                                               mas, compute_filtration)
         return stree
+
+
+# Every compiled module has its own timers and counters, gudhi.instrumentation merges them.
+def _instrumentation_report():
+    """Returns the timers and counters recorded in this module, see :func:`gudhi.instrumentation.report`."""
+    timers = {name.decode('utf-8'): timer for name, timer in instrumentation_timers()}
+    counters = {name.decode('utf-8'): value for name, value in instrumentation_counters()}
+    return timers, counters
+
+def _instrumentation_reset():
+    """Clears the timers and counters recorded in this module."""
+    instrumentation_reset()
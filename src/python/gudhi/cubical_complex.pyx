@@ -36,6 +36,7 @@ cdef extern from "Persistent_cohomology_interface.h" namespace "Gudhi":
     cdef cppclass Cubical_complex_persistence_interface "Gudhi::Persistent_cohomology_interface<Gudhi::Cubical_complex::Cubical_complex_interface<>>":
         Cubical_complex_persistence_interface(Bitmap_cubical_complex_base_interface * st, bool persistence_dim_max) nogil
         void compute_persistence(int homology_coeff_field, double min_persistence) nogil
+        void compute_persistence_in_chunks(int homology_coeff_field, double min_persistence) nogil
         vector[pair[int, pair[double, double]]] get_persistence() nogil
         vector[vector[int]] cofaces_of_cubical_persistence_pairs() nogil
         vector[int] betti_numbers() nogil
@@ -139,7 +140,7 @@ cdef class CubicalComplex:
         """
         return self.thisptr.dimension()
 
-    def compute_persistence(self, homology_coeff_field=11, min_persistence=0):
+    def compute_persistence(self, homology_coeff_field=11, min_persistence=0, in_chunks=False):
         """This function computes the persistence of the complex, so it can be
         accessed through :func:`persistent_betti_numbers`,
         :func:`persistence_intervals_in_dimension`, etc. This function is
@@ -154,6 +155,12 @@ cdef class CubicalComplex:
             0.0.
             Sets min_persistence to -1.0 to see all values.
         :type min_persistence: float.
+        :param in_chunks: If true, the boundary matrix is split into chunks
+            which are reduced in parallel (when GUDHI is built with TBB), then
+            the remaining columns are reduced together. The intervals are the
+            same, this is usually faster on large images. Default value is
+            False.
+        :type in_chunks: bool.
         :returns: Nothing.
         """
         if self.pcohptr != NULL:
@@ -161,11 +168,15 @@ cdef class CubicalComplex:
         assert self.__is_defined()
         cdef int field = homology_coeff_field
         cdef double minp = min_persistence
+        cdef bool chunks = in_chunks
         with nogil:
             self.pcohptr = new Cubical_complex_persistence_interface(self.thisptr, 1)
-            self.pcohptr.compute_persistence(field, minp)
+            if chunks:
+                self.pcohptr.compute_persistence_in_chunks(field, minp)
+            else:
+                self.pcohptr.compute_persistence(field, minp)
 
-    def persistence(self, homology_coeff_field=11, min_persistence=0):
+    def persistence(self, homology_coeff_field=11, min_persistence=0, in_chunks=False):
         """This function computes and returns the persistence of the complex.
 
         :param homology_coeff_field: The homology coefficient field. Must be a
@@ -176,10 +187,13 @@ cdef class CubicalComplex:
             0.0.
             Sets min_persistence to -1.0 to see all values.
         :type min_persistence: float.
+        :param in_chunks: If true, the persistence is computed with the chunk
+            reduction, see :func:`compute_persistence`. Default value is False.
+        :type in_chunks: bool.
         :returns: list of pairs(dimension, pair(birth, death)) -- the
             persistence of the complex.
         """
-        self.compute_persistence(homology_coeff_field, min_persistence)
+        self.compute_persistence(homology_coeff_field, min_persistence, in_chunks)
         return self.pcohptr.get_persistence()
 
     def cofaces_of_persistence_pairs(self):
@@ -0,0 +1,55 @@
+# This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+# See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+# Author(s):       Clément Maria
+#
+# Copyright (C) 2020 Inria
+#
+# Modification(s):
+#   - YYYY/MM Author: Description of the modification
+
+import importlib
+
+__author__ = "Clément Maria"
+__copyright__ = "Copyright (C) 2020 Inria"
+__license__ = "MIT"
+
+# Compiled modules whose algorithms are instrumented.
+_instrumented_modules = ["gudhi.simplex_tree", "gudhi.rips_complex", "gudhi.alpha_complex"]
+
+
+def _modules():
+    for name in _instrumented_modules:
+        try:
+            yield importlib.import_module(name)
+        except ImportError:
+            pass
+
+
+def report():
+    """Returns the timers and counters recorded since the start of the program or the last :func:`reset`, by the
+    construction and persistence algorithms. They are only recorded when GUDHI is built with the CMake option
+    `WITH_GUDHI_INSTRUMENTATION`, otherwise the report is empty.
+
+    The name of a timer is the path of the names of the enclosing timers, separated by '/', e.g.
+    `"Rips_complex::create_complex/Simplex_tree::expansion"`.
+
+    :returns: A dictionary with a `"timers"` entry, that maps the name of a timer to a pair (number of calls,
+        total time in seconds), and a `"counters"` entry, that maps the name of a counter to its value.
+    :rtype: dict
+    """
+    timers = {}
+    counters = {}
+    for module in _modules():
+        module_timers, module_counters = module._instrumentation_report()
+        for name, (calls, seconds) in module_timers.items():
+            previous_calls, previous_seconds = timers.get(name, (0, 0.0))
+            timers[name] = (previous_calls + calls, previous_seconds + seconds)
+        for name, value in module_counters.items():
+            counters[name] = counters.get(name, 0) + value
+    return {"timers": timers, "counters": counters}
+
+
+def reset():
+    """Clears the timers and counters."""
+    for module in _modules():
+        module._instrumentation_reset()
@@ -12,6 +12,7 @@ from libcpp.vector cimport vector
 from libcpp.utility cimport pair
 from libcpp cimport bool
 from libcpp.string cimport string
+from libc.stdint cimport uintmax_t
 
 __author__ = "Vincent Rouvreau"
 __copyright__ = "Copyright (C) 2016 Inria"
@@ -58,6 +59,9 @@ cdef extern from "Simplex_tree_interface.h" namespace "Gudhi":
         void compute_extended_filtration() nogil
         vector[vector[pair[int, pair[double, double]]]] compute_extended_persistence_subdiagrams(vector[pair[int, pair[double, double]]] dgm, double min_persistence) nogil
         Simplex_tree_interface_full_featured* collapse_edges(int nb_collapse_iteration) nogil
+        size_t get_serialization_size() nogil
+        void serialize(char* buffer, size_t buffer_size) nogil except +
+        void deserialize(const char* buffer, size_t buffer_size) nogil except +
         # Iterators over Simplex tree
         pair[vector[int], double] get_simplex_and_filtration(Simplex_tree_simplex_handle f_simplex) nogil
         Simplex_tree_simplices_iterator get_simplices_iterator_begin() nogil
@@ -79,3 +83,8 @@ cdef extern from "Persistent_cohomology_interface.h" namespace "Gudhi":
         vector[pair[vector[int], vector[int]]] persistence_pairs() nogil
         pair[vector[vector[int]], vector[vector[int]]] lower_star_generators() nogil
         pair[vector[vector[int]], vector[vector[int]]] flag_generators() nogil
+
+cdef extern from "Instrumentation_interface.h" namespace "Gudhi::instrumentation":
+    vector[pair[string, pair[size_t, double]]] instrumentation_timers() nogil
+    vector[pair[string, uintmax_t]] instrumentation_counters() nogil
+    void instrumentation_reset() nogil
@@ -54,6 +54,40 @@ cdef class SimplexTree:
         if self.pcohptr != NULL:
             del self.pcohptr
 
+    def __getstate__(self):
+        """:returns: The serialization of the SimplexTree, in a numpy array of bytes.
+
+        `__getstate__` and `__setstate__` are used by pickle. The serialization is binary and only depends on the
+        simplices, their filtration values and their keys, not on the memory layout of the SimplexTree.
+        """
+        cdef size_t buffer_size = self.get_ptr().get_serialization_size()
+        # numpy allocates the buffer, it is deleted with the returned array
+        np_buffer = numpy.empty(buffer_size, dtype='B')
+        cdef unsigned char[::1] buffer = np_buffer
+        cdef char* buffer_start = <char*>(&buffer[0])
+        with nogil:
+            self.get_ptr().serialize(buffer_start, buffer_size)
+        return np_buffer
+
+    def __setstate__(self, state):
+        """Replaces the SimplexTree with the one serialized in state by `__getstate__`.
+        """
+        cdef const unsigned char[::1] buffer = state
+        cdef size_t buffer_size = buffer.shape[0]
+        cdef const char* buffer_start = <const char*>(&buffer[0])
+        cdef Simplex_tree_interface_full_featured* ptr = self.get_ptr()
+        if ptr != NULL:
+            del ptr
+        if self.pcohptr != NULL:
+            del self.pcohptr
+            self.pcohptr = NULL
+        self.thisptr = <intptr_t>(new Simplex_tree_interface_full_featured())
+        with nogil:
+            self.get_ptr().deserialize(buffer_start, buffer_size)
+
+    def __reduce__(self):
+        return (SimplexTree, (), self.__getstate__())
+
     def __is_defined(self):
         """Returns true if SimplexTree pointer is not NULL.
          """
@@ -601,3 +635,15 @@ cdef class SimplexTree:
             self.thisptr = <intptr_t>(ptr.collapse_edges(nb_iter))
             # Delete old pointer
             del ptr
+
+
+# Every compiled module has its own timers and counters, gudhi.instrumentation merges them.
+def _instrumentation_report():
+    """Returns the timers and counters recorded in this module, see :func:`gudhi.instrumentation.report`."""
+    timers = {name.decode('utf-8'): timer for name, timer in instrumentation_timers()}
+    counters = {name.decode('utf-8'): value for name, value in instrumentation_counters()}
+    return timers, counters
+
+def _instrumentation_reset():
+    """Clears the timers and counters recorded in this module."""
+    instrumentation_reset()
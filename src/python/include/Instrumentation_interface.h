@@ -0,0 +1,45 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       Clément Maria
+ *
+ *    Copyright (C) 2020 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef INCLUDE_INSTRUMENTATION_INTERFACE_H_
+#define INCLUDE_INSTRUMENTATION_INTERFACE_H_
+
+#include <gudhi/Instrumentation.h>
+
+#include <vector>
+#include <string>
+#include <utility>  // for std::pair
+#include <cstdint>  // for std::uintmax_t
+#include <cstddef>  // for std::size_t
+
+namespace Gudhi {
+
+namespace instrumentation {
+
+// Every Python module has its own registry, that gudhi.instrumentation merges.
+inline std::vector<std::pair<std::string, std::pair<std::size_t, double>>> instrumentation_timers() {
+  std::vector<std::pair<std::string, std::pair<std::size_t, double>>> timers;
+  for (const Timer_record& timer : report().timers)
+    timers.emplace_back(timer.name, std::make_pair(timer.calls, timer.seconds));
+  return timers;
+}
+
+inline std::vector<std::pair<std::string, std::uintmax_t>> instrumentation_counters() {
+  Report r = report();
+  return std::vector<std::pair<std::string, std::uintmax_t>>(r.counters.begin(), r.counters.end());
+}
+
+inline void instrumentation_reset() { reset(); }
+
+}  // namespace instrumentation
+
+}  // namespace Gudhi
+
+#endif  // INCLUDE_INSTRUMENTATION_INTERFACE_H_
@@ -54,6 +54,12 @@ persistent_cohomology::Persistent_cohomology<FilteredComplex, persistent_cohomol
     Base::compute_persistent_cohomology(min_persistence);
   }
 
+  // Same intervals as compute_persistence, with the chunk reduction, which is parallel when TBB is available.
+  void compute_persistence_in_chunks(int homology_coeff_field, double min_persistence) {
+    Base::init_coefficients(homology_coeff_field);
+    Base::compute_persistent_cohomology(min_persistence, persistent_cohomology::Chunk_reduction());
+  }
+
   std::vector<std::pair<int, std::pair<double, double>>> get_persistence() {
     std::vector<std::pair<int, std::pair<double, double>>> persistence;
     auto const& persistent_pairs = Base::get_persistent_pairs();
@@ -174,3 +174,12 @@ def test_periodic_cofaces_of_persistence_pairs_when_pd_has_no_paired_birth_and_d
     assert np.array_equal(pairs[1][0], np.array([0]))
     assert np.array_equal(pairs[1][1], np.array([0, 1]))
     assert np.array_equal(pairs[1][2], np.array([1]))
+
+def test_cubical_persistence_in_chunks():
+    np.random.seed(0)
+    for cells in [np.random.rand(20, 20, 20), np.random.randint(5, size=(30, 30))]:
+        cub = CubicalComplex(top_dimensional_cells = cells)
+        diag = sorted(cub.persistence(homology_coeff_field=3))
+        diag_in_chunks = sorted(cub.persistence(homology_coeff_field=3, in_chunks=True))
+        assert diag == diag_in_chunks
+        assert len(diag) > 0
@@ -0,0 +1,31 @@
+""" This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+    Author(s):       Clément Maria
+
+    Copyright (C) 2020 Inria
+
+    Modification(s):
+      - YYYY/MM Author: Description of the modification
+"""
+
+from gudhi import RipsComplex, instrumentation
+
+__author__ = "Clément Maria"
+__copyright__ = "Copyright (C) 2020 Inria"
+__license__ = "MIT"
+
+
+def test_instrumentation_report():
+    instrumentation.reset()
+    points = [[0, 0], [1, 0], [0, 1], [1, 1]]
+    stree = RipsComplex(points=points, max_edge_length=2.).create_simplex_tree(max_dimension=2)
+    stree.persistence()
+    report = instrumentation.report()
+    assert set(report.keys()) == {"timers", "counters"}
+    # Empty unless GUDHI is built with WITH_GUDHI_INSTRUMENTATION
+    if report["timers"]:
+        assert "Rips_complex::create_complex/Simplex_tree::expansion" in report["timers"]
+        calls, seconds = report["timers"]["Persistent_cohomology::compute_persistent_cohomology"]
+        assert calls == 1 and seconds >= 0
+    instrumentation.reset()
+    assert instrumentation.report() == {"timers": {}, "counters": {}}
@@ -10,6 +10,7 @@
 
 from gudhi import SimplexTree
 import pytest
+import pickle
 
 __author__ = "Vincent Rouvreau"
 __copyright__ = "Copyright (C) 2016 Inria"
@@ -358,3 +359,20 @@ def test_collapse_edges():
     assert st.find([1, 3]) == False
     for simplex in st.get_skeleton(0): 
         assert simplex[1] == 1. 
+
+def test_pickle_simplex_tree():
+    st = SimplexTree()
+
+    assert st.insert([0, 1, 2], filtration=1.0) == True
+    assert st.insert([1, 3], filtration=2.0) == True
+    assert st.insert([4], filtration=0.5) == True
+    st.expansion(3)
+
+    st_copy = pickle.loads(pickle.dumps(st))
+    assert st_copy.num_simplices() == st.num_simplices()
+    assert st_copy.dimension() == st.dimension()
+    assert list(st_copy.get_filtration()) == list(st.get_filtration())
+    assert st_copy.persistence() == st.persistence()
+
+    st_empty = pickle.loads(pickle.dumps(SimplexTree()))
+    assert st_empty.num_simplices() == 0